@@ -0,0 +1,86 @@
+#include <string.h>
+#include "acquisition.h"
+#include "vanny-hub.h"
+
+static uint32_t acquisition_period_ms;
+static AcquisitionNotify_t acquisition_notify;
+
+// Core 1 state
+static AcquisitionSample_t current;
+
+// Shared state, head is only written by core 1 and tail only by core 0
+static AcquisitionSample_t queue[ACQUISITION_QUEUE_SIZE];
+static volatile uint32_t queue_head;
+static volatile uint32_t queue_tail;
+
+static bool queue_push(const AcquisitionSample_t* sample) {
+  const uint32_t head = queue_head;
+
+  if(head - queue_tail >= ACQUISITION_QUEUE_SIZE)
+    return false;
+
+  memcpy(&queue[head & (ACQUISITION_QUEUE_SIZE - 1)], sample, sizeof(AcquisitionSample_t));
+  __dmb();
+  queue_head = head + 1;
+
+  return true;
+}
+
+// Called from core 0
+bool acquisition_pop(AcquisitionSample_t* sample) {
+  const uint32_t tail = queue_tail;
+
+  if(tail == queue_head)
+    return false;
+
+  __dmb();
+  memcpy(sample, &queue[tail & (ACQUISITION_QUEUE_SIZE - 1)], sizeof(AcquisitionSample_t));
+  __dmb();
+  queue_tail = tail + 1;
+
+  return true;
+}
+
+static void poll_device(Device_t device, uart_inst_t* inst, uint8_t unit, uint16_t address, uint16_t count, uint16_t* registers) {
+  DeviceHealth_t* health = &current.health[device];
+  uint8_t state = devices_modbus_read_registers(inst, unit, address, count, registers);
+
+  health->polls++;
+  health->last_state = state;
+
+  if(state == ACQUISITION_MODBUS_OK) {
+    health->consecutive_failures = 0;
+    health->last_ok_at = time_us_64();
+  } else {
+    health->failures++;
+    health->consecutive_failures++;
+    printf("Device %d (unit %02x) failed to read registers, returned: %d\n", device, unit, state);
+  }
+}
+
+static void acquisition_core1_entry() {
+  absolute_time_t next = get_absolute_time();
+
+  while(1) {
+    next = delayed_by_ms(next, acquisition_period_ms);
+
+    poll_device(DeviceRvr40, RS232_PORT, RS232_RVR40_ADDRESS, RVR40_REG_START, RVR40_REG_END, current.rvr40);
+    poll_device(DeviceLfp100s, RS485_PORT, RS485_LFP100S_ADDRESS, LFP100S_REG_START, LFP100S_REG_END, current.lfp100s);
+    poll_device(DeviceDcc50s, RS485_PORT, RS485_DCC50S_ADDRESS, DCC50S_REG_START, DCC50S_REG_END, current.dcc50s);
+    current.sampled_at = time_us_64();
+
+    if(!queue_push(&current)) {
+      current.dropped++;
+    }
+    acquisition_notify();
+
+    sleep_until(next);
+  }
+}
+
+void acquisition_start(uint32_t period_ms, AcquisitionNotify_t notify) {
+  acquisition_period_ms = period_ms;
+  acquisition_notify = notify;
+
+  multicore_launch_core1(acquisition_core1_entry);
+}
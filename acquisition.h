@@ -0,0 +1,45 @@
+#pragma once
+
+#include <pico/stdlib.h>
+#include <hardware/sync.h>
+#include <pico/multicore.h>
+
+#include "devices-modbus.h"
+
+#define ACQUISITION_QUEUE_SIZE  4     // power of two
+#define ACQUISITION_MODBUS_OK   3     // function code echoed by a successful read
+
+typedef enum {
+  DeviceRvr40,
+  DeviceLfp100s,
+  DeviceDcc50s,
+  DeviceCount,
+} Device_t;
+
+typedef struct {
+  uint32_t polls;
+  uint32_t failures;
+  uint16_t consecutive_failures;
+  uint8_t last_state;
+  uint64_t last_ok_at;
+} DeviceHealth_t;
+
+// One complete polling round of every device
+typedef struct {
+  uint64_t sampled_at;
+  uint32_t dropped;         // samples lost to a full queue so far
+  uint16_t dcc50s[DCC50S_REG_END];
+  uint16_t rvr40[RVR40_REG_END];
+  uint16_t lfp100s[LFP100S_REG_END];
+  DeviceHealth_t health[DeviceCount];
+} AcquisitionSample_t;
+
+typedef void (*AcquisitionNotify_t)();
+
+/* Modbus acquisition, running alone on core 1
+ *  Every period the devices are polled into core 1's register caches, and the
+ *  round is pushed onto a single producer, single consumer queue in shared memory.
+ *  notify is then called (from core 1) so core 0 can drain it with acquisition_pop().
+ */
+void acquisition_start(uint32_t period_ms, AcquisitionNotify_t notify);
+bool acquisition_pop(AcquisitionSample_t* sample);
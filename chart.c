@@ -0,0 +1,262 @@
+#include "display/display.h"
+#include "chart.h"
+#include "format.h"
+
+// x axis label spacings tried, in samples below a day and in days above
+static const uint16_t chart_sample_steps[] = { 1, 2, 3, 6, 12 };
+static const uint16_t chart_day_steps[] = { 1, 2, 7 };
+
+// Smallest 1, 2 or 5 times a power of ten at or above value
+static int32_t chart_nice(int32_t value) {
+  int32_t decade = 1;
+
+  while(decade <= value / 10)
+    decade *= 10;
+
+  if(value <= decade)
+    return decade;
+  if(value <= decade * 2)
+    return decade * 2;
+  if(value <= decade * 5)
+    return decade * 5;
+  return decade * 10;
+}
+
+// Round the range of a fitted axis out to nice values covering its series
+static void chart_fit(const Chart_t* chart, ChartAxis_t axis, const StatsQuery_t* query, ChartRange_t* range) {
+  const uint16_t count = query->history->count;
+  float min = 0.f, max = 0.f;
+  StatsAggregate_t all;
+
+  for(uint8_t s = 0; s < chart->series_count; s++) {
+    const ChartSeries_t* series = &chart->series[s];
+    if(series->axis != axis || !stats_query_aggregate(query, series->series, 0, count, &all))
+      continue;
+
+    const float scale = stats_history_scale(series->series);
+    if(all.min * scale < min)
+      min = all.min * scale;
+    if(all.max * scale > max)
+      max = all.max * scale;
+  }
+
+  range->max = chart_nice((int32_t)(max + 0.999f));
+  range->min = min < 0 ? -chart_nice((int32_t)(-min + 0.999f)) : 0;
+}
+
+// Column of sample i, where the series draw it
+inline static int16_t chart_x(const Chart_t* chart, uint16_t count, uint32_t i) {
+  const uint32_t columns = chart->x1 - chart->x0 + 1;
+
+  if(count > columns)
+    return chart->x0 + i * columns / count;
+  return chart->x0 + (count > 1 ? i * (columns - 1) / (count - 1) : columns - 1);
+}
+
+inline static int16_t chart_y(const Chart_t* chart, int32_t raw, int32_t raw_min, int32_t raw_max) {
+  const int32_t y = chart->y1 - (raw - raw_min) * (chart->y1 - chart->y0) / (raw_max - raw_min);
+
+  if(y < chart->y0)
+    return chart->y0;
+  if(y > chart->y1)
+    return chart->y1;
+  return y;
+}
+
+// Value at position / span samples from the oldest
+inline static int32_t chart_interpolate(const StatsHistory_t* history, StatSeries_t series, uint32_t position, uint32_t span) {
+  const uint16_t i = position / span;
+  const int32_t fraction = position % span;
+  const int32_t value = stats_history_value(history, series, i);
+
+  if(fraction == 0)
+    return value;
+  return value + (stats_history_value(history, series, i + 1) - value) * fraction / (int32_t)span;
+}
+
+// A 4x4 marker at each day's mean (from the prefix sums), in the middle of the day
+static void chart_draw_day_means(const Chart_t* chart, const ChartSeries_t* series, int32_t raw_min, int32_t raw_max, const StatsQuery_t* query) {
+  const uint16_t count = query->history->count;
+  const uint16_t day = chart->day_samples;
+  StatsAggregate_t window;
+
+  if(day == 0)
+    return;
+
+  for(uint16_t t1 = count; t1 >= day; t1 -= day) {
+    if(!stats_query_aggregate(query, series->series, t1 - day, t1, &window))
+      return;
+
+    const int16_t x = chart_x(chart, count, t1 - day + day / 2);
+    const int16_t y = chart_y(chart, stats_aggregate_mean(&window), raw_min, raw_max);
+
+    display_draw_fill(x > chart->x0 ? x - 1 : x, y > chart->y0 ? y - 1 : y,
+        x + 2 < chart->x1 ? x + 2 : chart->x1, y + 2 < chart->y1 ? y + 2 : chart->y1, series->colour);
+  }
+}
+
+static void chart_draw_series(const Chart_t* chart, const ChartSeries_t* series, const ChartRange_t* range, const StatsQuery_t* query) {
+  const StatsHistory_t* history = query->history;
+  const uint32_t count = history->count;
+  const uint32_t columns = chart->x1 - chart->x0 + 1;
+  const uint32_t span = columns - 1;
+
+  // axis range in the series' raw (quantised) units
+  const float scale = stats_history_scale(series->series);
+  const int32_t raw_min = range->min / scale;
+  const int32_t raw_max = range->max / scale;
+
+  int16_t last_top = 0, last_bottom = 0;
+  StatsAggregate_t window;
+
+  if(series->style == ChartDayMean) {
+    chart_draw_day_means(chart, series, raw_min, raw_max, query);
+    return;
+  }
+
+  for(uint32_t c = 0; c < columns; c++) {
+    int32_t low, high;
+
+    if(count > columns) {
+      // envelope of every sample under the column
+      const uint16_t t0 = c * count / columns;
+      const uint16_t t1 = ((c + 1) * count + columns - 1) / columns;
+
+      stats_query_aggregate(query, series->series, t0, t1, &window);
+      low = window.min;
+      high = window.max;
+    } else if(count > 1 && span > 0) {
+      // the interpolated line across the column, and the sample it passes (if any)
+      const uint32_t from = c * (count - 1);
+      const uint32_t to = c < span ? from + count - 1 : from;
+      const int32_t start = chart_interpolate(history, series->series, from, span);
+      const int32_t end = chart_interpolate(history, series->series, to, span);
+
+      low = start < end ? start : end;
+      high = start < end ? end : start;
+
+      if(to / span > from / span) {
+        const int32_t sample = stats_history_value(history, series->series, to / span);
+        if(sample < low)
+          low = sample;
+        if(sample > high)
+          high = sample;
+      }
+    } else {
+      low = high = stats_history_value(history, series->series, count - 1);
+    }
+
+    const int16_t top = chart_y(chart, high, raw_min, raw_max);
+    const int16_t bottom = chart_y(chart, low, raw_min, raw_max);
+
+    // reach the previous column's envelope, so the trace stays connected
+    int16_t from = top, to = bottom;
+    if(c > 0) {
+      if(from > last_bottom)
+        from = last_bottom;
+      if(to < last_top)
+        to = last_top;
+    }
+    last_top = top;
+    last_bottom = bottom;
+
+    if(series->style == ChartDotted && (c & 1))
+      continue;
+
+    const int16_t x = chart->x0 + c;
+    if(from == to)
+      display_draw_pixel(x, from, series->colour);
+    else
+      display_draw_line(x, from, x, to, series->colour);
+  }
+}
+
+/* Samples between x axis labels, the first step leaving CHART_TICK_MIN_PX between them
+ *  Whole days once the history holds CHART_DAYS_MIN of them, and samples before.
+ */
+static uint16_t chart_tick_step(const Chart_t* chart, uint16_t count) {
+  const uint32_t columns = chart->x1 - chart->x0 + 1;
+  uint16_t step = 1;
+
+  if(!chart_in_days(chart, count)) {
+    for(uint8_t i = 0; i < sizeof(chart_sample_steps) / sizeof(chart_sample_steps[0]); i++) {
+      step = chart_sample_steps[i];
+      if(step >= chart->day_samples)
+        break;
+      if(step * columns >= CHART_TICK_MIN_PX * (uint32_t)count)
+        return step;
+    }
+  }
+
+  for(uint8_t i = 0; i < sizeof(chart_day_steps) / sizeof(chart_day_steps[0]); i++) {
+    step = chart_day_steps[i] * chart->day_samples;
+    if(step * columns >= CHART_TICK_MIN_PX * (uint32_t)count)
+      break;
+  }
+
+  return step;
+}
+
+// Label every step samples back from the newest, in samples or days ago
+static void chart_draw_ticks(const Chart_t* chart, uint16_t count, uint16_t step) {
+  char label[8];
+  Format_t text;
+
+  for(uint16_t ago = step; ago <= count; ago += step) {
+    const int16_t x = chart_x(chart, count, count - ago);
+
+    format_init(&text, label, sizeof(label));
+    format_int(&text, step >= chart->day_samples ? ago / chart->day_samples : ago, UnitNone);
+    display_draw_text(label, x - 5, chart->y1 + 8, Black);
+  }
+}
+
+// Right aligned to the plot's left edge, clear of its frame
+static void chart_draw_range_label(const Chart_t* chart, const char* label, int16_t y) {
+  const int16_t x = chart->x0 - 2 - display_text_width(label);
+
+  display_draw_text((char*)label, x > 0 ? x : 0, y, Black);
+}
+
+// Draw the series (and labels) of a chart
+void chart_draw(const Chart_t* chart, const StatsQuery_t* query) {
+  const uint16_t count = query->history->count;
+  ChartRange_t ranges[ChartAxisCount];
+  char label[12];
+  Format_t text;
+
+  if(count == 0)
+    return;
+
+  for(uint8_t a = 0; a < ChartAxisCount; a++) {
+    ranges[a] = chart->axes[a];
+    if(ranges[a].min == ranges[a].max)
+      chart_fit(chart, a, query, &ranges[a]);
+  }
+
+  for(uint8_t s = 0; s < chart->series_count; s++) {
+    chart_draw_series(chart, &chart->series[s], &ranges[chart->series[s].axis], query);
+  }
+
+  /* the fitted ranges change with the data, so are labelled outside the plot, left of it
+   *  and inset from its corners, which the fixed axes' own labels keep. The unit goes
+   *  under the maximum, the minimum is only labelled below zero.
+   */
+  for(uint8_t a = 0; a < ChartAxisCount; a++) {
+    if(chart->axes[a].min != chart->axes[a].max || ranges[a].unit == NULL)
+      continue;
+
+    format_init(&text, label, sizeof(label));
+    format_int(&text, ranges[a].max, UnitNone);
+    chart_draw_range_label(chart, label, chart->y0 + CHART_RANGE_INSET);
+    chart_draw_range_label(chart, ranges[a].unit, chart->y0 + CHART_RANGE_INSET + FontNormal.font_height);
+
+    if(ranges[a].min < 0) {
+      format_init(&text, label, sizeof(label));
+      format_int(&text, ranges[a].min, UnitNone);
+      chart_draw_range_label(chart, label, chart->y1 - CHART_RANGE_INSET - FontNormal.font_height);
+    }
+  }
+
+  chart_draw_ticks(chart, count, chart_tick_step(chart, count));
+}
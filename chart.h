@@ -0,0 +1,62 @@
+#pragma once
+
+#include "display/canvas.h"
+#include "stats-query.h"
+
+#define CHART_TICK_MIN_PX   24    // closest spacing of the x axis labels
+#define CHART_DAYS_MIN      2     // whole days of history before the x axis counts days
+#define CHART_RANGE_INSET   10    // of the fitted range labels, from the plot's top and bottom
+
+typedef enum {
+  ChartLine,            // every column
+  ChartDotted,          // every other column
+  ChartDayMean,         // a marker at the mean of each whole day, back from the newest sample
+} ChartStyle_t;
+
+typedef enum {
+  ChartAxisLeft,
+  ChartAxisRight,
+  ChartAxisCount,
+} ChartAxis_t;
+
+typedef struct {
+  StatSeries_t series;
+  colour_t colour;
+  ChartStyle_t style;
+  ChartAxis_t axis;
+} ChartSeries_t;
+
+// Range of an axis in the series' units, fit to the data when min == max
+typedef struct {
+  int32_t min;
+  int32_t max;
+  const char* unit;     // labels a fitted range, drawn left of the plot
+} ChartRange_t;
+
+/* History chart over a plot area (landscape, inclusive)
+ *  Plots narrower than the history draw each pixel column as the min/max envelope
+ *  of its window of samples, joined to the previous column, so no spike is lost.
+ *  Histories shorter than the plot are interpolated between samples instead, which
+ *  is always the case for the full width statistics page (269 columns against at
+ *  most STATS_MAX_HISTORY samples), the envelope is only reached on narrower plots.
+ *  Either way the cost follows the plot's width, not the history length.
+ */
+typedef struct {
+  int16_t x0;
+  int16_t y0;
+  int16_t x1;
+  int16_t y1;
+
+  const ChartSeries_t* series;      // drawn in order, the last on top
+  uint8_t series_count;
+  ChartRange_t axes[ChartAxisCount];
+
+  uint16_t day_samples;             // samples in a day, see chart_in_days()
+} Chart_t;
+
+// Whether the x axis over count samples is labelled in days (or in samples)
+inline static bool chart_in_days(const Chart_t* chart, uint16_t count) {
+  return chart->day_samples > 0 && count >= CHART_DAYS_MIN * chart->day_samples;
+}
+
+void chart_draw(const Chart_t* chart, const StatsQuery_t* query);
@@ -19,8 +19,8 @@
 #define LFP100S_REG_MAX_CAPACITY_2  5 // 5047
 #define LFP100S_REG_END             6
 
-float battery_max_capacity();
-float battery_capacity();
-float battery_percentage();
-float battery_amperes();
-float battery_voltage();
+float battery_max_capacity(const uint16_t* lfp100s);
+float battery_capacity(const uint16_t* lfp100s);
+float battery_percentage(const uint16_t* lfp100s);
+float battery_amperes(const uint16_t* lfp100s);
+float battery_voltage(const uint16_t* lfp100s);
@@ -0,0 +1,331 @@
+#include <stdlib.h>
+#include "canvas.h"
+
+// Native row of the landscape x coordinate
+#define CANVAS_ROW(x) (DISPLAY_H - 1 - (x))
+
+// Landscape x range [min, max) covered by the rows of a canvas
+#define CANVAS_X_MIN(canvas) (DISPLAY_H - (canvas)->row_start - (canvas)->rows)
+#define CANVAS_X_MAX(canvas) (DISPLAY_H - (canvas)->row_start)
+
+// Offset into the planes of the native row of x
+#define CANVAS_OFFSET(canvas, x) ((CANVAS_ROW(x) - (canvas)->row_start) * SCREEN_W)
+
+// Whether a colour inks (clears bits on) the black and red planes
+#define INK_BLACK(colour) ((colour) == Black)
+#define INK_RED(colour)   ((colour) == Red || (colour) == Yellow)
+
+// Write masked bits of a plane byte as ink (cleared) or White (set)
+#define PLANE_WRITE(byte, mask, ink) \
+  ((ink) ? (byte) & ~(mask) : (byte) | (mask))
+
+// Planes of rows native rows from row_start, SCREEN_H rows for the whole screen
+void canvas_init(Canvas_t* canvas, uint8_t* black, uint8_t* red, uint16_t row_start, uint16_t rows) {
+  canvas->black = black;
+  canvas->red = red;
+  canvas->row_start = row_start;
+  canvas->rows = rows;
+  canvas->sent_black = NULL;
+  canvas->sent_red = NULL;
+}
+
+void canvas_fill(Canvas_t* canvas, colour_t colour) {
+  memset(canvas->black, INK_BLACK(colour) ? 0x00 : 0xff, canvas->rows * SCREEN_W);
+  memset(canvas->red, INK_RED(colour) ? 0x00 : 0xff, canvas->rows * SCREEN_W);
+}
+
+void canvas_pixel(Canvas_t* canvas, int16_t x, int16_t y, colour_t colour) {
+  if(x < CANVAS_X_MIN(canvas) || x >= CANVAS_X_MAX(canvas) || (uint16_t)y >= DISPLAY_W)
+    return;
+
+  const uint16_t offset = CANVAS_OFFSET(canvas, x) + (y >> 3);
+  const uint8_t bit = 0x80 >> (y & 7);
+
+  canvas->black[offset] = PLANE_WRITE(canvas->black[offset], bit, INK_BLACK(colour));
+  canvas->red[offset] = PLANE_WRITE(canvas->red[offset], bit, INK_RED(colour));
+}
+
+// Masked write of native bits [n0, n1) of one row, whole bytes in between
+inline static void canvas_row_span(uint8_t* row, int16_t n0, int16_t n1, bool ink) {
+  int16_t b0 = n0 >> 3;
+  const int16_t b1 = (n1 - 1) >> 3;
+  const uint8_t head = 0xff >> (n0 & 7);
+  const uint8_t tail = 0xff << (7 - ((n1 - 1) & 7));
+
+  if(b0 == b1) {
+    row[b0] = PLANE_WRITE(row[b0], head & tail, ink);
+    return;
+  }
+
+  row[b0] = PLANE_WRITE(row[b0], head, ink);
+  for(b0++; b0 < b1; b0++) {
+    row[b0] = ink ? 0x00 : 0xff;
+  }
+  row[b1] = PLANE_WRITE(row[b1], tail, ink);
+}
+
+// Horizontal on screen, one bit in each of the native rows
+void canvas_hspan(Canvas_t* canvas, int16_t x0, int16_t x1, int16_t y, colour_t colour) {
+  if((uint16_t)y >= DISPLAY_W)
+    return;
+  if(x0 < CANVAS_X_MIN(canvas))
+    x0 = CANVAS_X_MIN(canvas);
+  if(x1 > CANVAS_X_MAX(canvas))
+    x1 = CANVAS_X_MAX(canvas);
+  if(x0 >= x1)
+    return;
+
+  const bool ink_black = INK_BLACK(colour);
+  const bool ink_red = INK_RED(colour);
+  const uint8_t bit = 0x80 >> (y & 7);
+  const uint16_t end = CANVAS_OFFSET(canvas, x0) + (y >> 3);
+
+  for(uint16_t offset = CANVAS_OFFSET(canvas, x1 - 1) + (y >> 3); offset <= end; offset += SCREEN_W) {
+    canvas->black[offset] = PLANE_WRITE(canvas->black[offset], bit, ink_black);
+    canvas->red[offset] = PLANE_WRITE(canvas->red[offset], bit, ink_red);
+  }
+}
+
+// Vertical on screen, contiguous bits of a single native row
+void canvas_vspan(Canvas_t* canvas, int16_t x, int16_t y0, int16_t y1, colour_t colour) {
+  if(x < CANVAS_X_MIN(canvas) || x >= CANVAS_X_MAX(canvas))
+    return;
+  if(y0 < 0)
+    y0 = 0;
+  if(y1 > DISPLAY_W)
+    y1 = DISPLAY_W;
+  if(y0 >= y1)
+    return;
+
+  const uint16_t offset = CANVAS_OFFSET(canvas, x);
+  canvas_row_span(&canvas->black[offset], y0, y1, INK_BLACK(colour));
+  canvas_row_span(&canvas->red[offset], y0, y1, INK_RED(colour));
+}
+
+void canvas_fill_rect(Canvas_t* canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, colour_t colour) {
+  if(x0 < CANVAS_X_MIN(canvas))
+    x0 = CANVAS_X_MIN(canvas);
+  if(x1 > CANVAS_X_MAX(canvas))
+    x1 = CANVAS_X_MAX(canvas);
+  if(y0 < 0)
+    y0 = 0;
+  if(y1 > DISPLAY_W)
+    y1 = DISPLAY_W;
+  if(x0 >= x1 || y0 >= y1)
+    return;
+
+  const bool ink_black = INK_BLACK(colour);
+  const bool ink_red = INK_RED(colour);
+  uint16_t offset = CANVAS_OFFSET(canvas, x1 - 1);
+
+  for(int16_t x = x0; x < x1; x++, offset += SCREEN_W) {
+    canvas_row_span(&canvas->black[offset], y0, y1, ink_black);
+    canvas_row_span(&canvas->red[offset], y0, y1, ink_red);
+  }
+}
+
+// Outline, inclusive of both corners
+void canvas_rect(Canvas_t* canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, colour_t colour) {
+  canvas_hspan(canvas, x0, x1 + 1, y0, colour);
+  canvas_hspan(canvas, x0, x1 + 1, y1, colour);
+  canvas_vspan(canvas, x0, y0, y1 + 1, colour);
+  canvas_vspan(canvas, x1, y0, y1 + 1, colour);
+}
+
+// Bresenham line, inclusive of both end points
+void canvas_line(Canvas_t* canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, colour_t colour) {
+  if(y0 == y1) {
+    canvas_hspan(canvas, x0 < x1 ? x0 : x1, (x0 < x1 ? x1 : x0) + 1, y0, colour);
+    return;
+  }
+  if(x0 == x1) {
+    canvas_vspan(canvas, x0, y0 < y1 ? y0 : y1, (y0 < y1 ? y1 : y0) + 1, colour);
+    return;
+  }
+
+  const int16_t dx = abs(x1 - x0);
+  const int16_t dy = -abs(y1 - y0);
+  const int16_t sx = x0 < x1 ? 1 : -1;
+  const int16_t sy = y0 < y1 ? 1 : -1;
+  int16_t err = dx + dy;
+
+  while(1) {
+    canvas_pixel(canvas, x0, y0, colour);
+    if(x0 == x1 && y0 == y1)
+      break;
+
+    const int16_t e2 = 2 * err;
+    if(e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if(e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+/* Composite a pre-rotated bitmap (see tools/native-bitmaps.py) at x, y
+ *  Each of the w columns is ceil(h / 8) bytes MSB first, at most 24 bits tall.
+ *  Whole columns are shifted into place and merged a byte at a time, opaque
+ *  bitmaps also paint their unset bits White.
+ */
+void canvas_blit(Canvas_t* canvas, int16_t x, int16_t y, const uint8_t* columns, uint8_t w, uint8_t h, colour_t colour, bool opaque) {
+  const uint8_t column_bytes = (h + 7) >> 3;
+  const uint8_t shift = y & 7;
+  const int16_t first_byte = y >> 3;
+  const uint8_t span_bytes = (shift + h + 7) >> 3;
+  const uint32_t mask = (0xffffffffu << (32 - h)) >> shift;
+  const bool ink_black = INK_BLACK(colour);
+  const bool ink_red = INK_RED(colour);
+  const int16_t x_min = CANVAS_X_MIN(canvas);
+  const int16_t x_max = CANVAS_X_MAX(canvas);
+
+  for(uint8_t c = 0; c < w; c++, columns += column_bytes) {
+    const int16_t col = x + c;
+    if(col < x_min || col >= x_max)
+      continue;
+
+    uint32_t bits = (uint32_t)columns[0] << 24;
+    if(column_bytes > 1)
+      bits |= (uint32_t)columns[1] << 16;
+    if(column_bytes > 2)
+      bits |= (uint32_t)columns[2] << 8;
+    bits >>= shift;
+
+    const uint16_t offset = CANVAS_OFFSET(canvas, col);
+    for(uint8_t k = 0; k < span_bytes; k++) {
+      const int16_t b = first_byte + k;
+      if((uint16_t)b >= SCREEN_W)
+        continue;
+
+      const uint8_t g = bits >> (24 - 8 * k);
+      const uint8_t m = opaque ? (uint8_t)(mask >> (24 - 8 * k)) : g;
+      uint8_t* black = &canvas->black[offset + b];
+      uint8_t* red = &canvas->red[offset + b];
+
+      if(ink_black || ink_red) {
+        // whiten the cell on both planes, then ink the glyph bits on its own plane
+        *black = PLANE_WRITE(*black | m, g, ink_black);
+        *red = PLANE_WRITE(*red | m, g, ink_red);
+      } else {
+        // White glyph, opaque cells are Black behind it
+        *black = (*black & ~m) | g;
+        *red |= m;
+      }
+    }
+  }
+}
+
+inline static uint32_t canvas_rect_area(const CanvasRect_t* rect) {
+  return (uint32_t)(rect->byte_end - rect->byte_start + 1) * (rect->row_end - rect->row_start + 1);
+}
+
+inline static void canvas_rect_union(CanvasRect_t* into, const CanvasRect_t* rect) {
+  if(rect->byte_start < into->byte_start)
+    into->byte_start = rect->byte_start;
+  if(rect->byte_end > into->byte_end)
+    into->byte_end = rect->byte_end;
+  if(rect->row_start < into->row_start)
+    into->row_start = rect->row_start;
+  if(rect->row_end > into->row_end)
+    into->row_end = rect->row_end;
+}
+
+/* Regions where either plane differs from what was last sent to the panel
+ *  Damaged rows are bridged over small gaps into rectangles, and the pair of
+ *  neighbours costing the least extra area is merged until at most max remain.
+ *  Returns the amount of rectangles, 0 when nothing changed.
+ */
+uint8_t canvas_damage(const Canvas_t* canvas, CanvasRect_t* rects, uint8_t max) {
+  uint8_t count = 0;
+  uint16_t clean_rows = 0;
+
+  if(canvas->sent_black == NULL || canvas->sent_red == NULL) {
+    rects[0] = (CanvasRect_t){ 0, SCREEN_W - 1, 0, SCREEN_H - 1 };
+    return 1;
+  }
+
+  for(uint16_t row = 0; row < SCREEN_H; row++) {
+    const uint16_t offset = row * SCREEN_W;
+    int8_t first = -1, last = -1;
+
+    for(uint8_t b = 0; b < SCREEN_W; b++) {
+      if(canvas->black[offset + b] != canvas->sent_black[offset + b]
+          || canvas->red[offset + b] != canvas->sent_red[offset + b]) {
+        if(first < 0)
+          first = b;
+        last = b;
+      }
+    }
+
+    if(first < 0) {
+      clean_rows++;
+      continue;
+    }
+
+    CanvasRect_t damaged = { first, last, row, row };
+    if(count > 0 && clean_rows <= CANVAS_DAMAGE_GAP) {
+      canvas_rect_union(&rects[count - 1], &damaged);
+    } else if(count < max) {
+      rects[count++] = damaged;
+    } else {
+      // out of rectangles, grow the last one
+      canvas_rect_union(&rects[count - 1], &damaged);
+    }
+    clean_rows = 0;
+  }
+
+  // Merge neighbours where it is cheap to do so
+  while(count > 1) {
+    uint8_t best = 0;
+    uint32_t best_cost = UINT32_MAX;
+
+    for(uint8_t i = 0; i + 1 < count; i++) {
+      CanvasRect_t merged = rects[i];
+      canvas_rect_union(&merged, &rects[i + 1]);
+
+      uint32_t cost = canvas_rect_area(&merged) - canvas_rect_area(&rects[i]) - canvas_rect_area(&rects[i + 1]);
+      if(cost < best_cost) {
+        best = i;
+        best_cost = cost;
+      }
+    }
+
+    // only worth it if cheaper than the overhead of another window and refresh
+    if(best_cost > SCREEN_W * CANVAS_DAMAGE_GAP)
+      break;
+
+    canvas_rect_union(&rects[best], &rects[best + 1]);
+    for(uint8_t i = best + 1; i + 1 < count; i++) {
+      rects[i] = rects[i + 1];
+    }
+    count--;
+  }
+
+  return count;
+}
+
+// FNV-1a over both planes, cheap enough to run on every frame to spot repeats
+uint32_t canvas_fingerprint(const Canvas_t* canvas) {
+  uint32_t hash = 2166136261u;
+
+  for(uint16_t i = 0; i < CANVAS_SIZE; i++) {
+    hash = (hash ^ canvas->black[i]) * 16777619u;
+  }
+  for(uint16_t i = 0; i < CANVAS_SIZE; i++) {
+    hash = (hash ^ canvas->red[i]) * 16777619u;
+  }
+
+  return hash;
+}
+
+// The planes have been sent to the panel, damage is now relative to them
+void canvas_mark_sent(Canvas_t* canvas) {
+  if(canvas->sent_black == NULL || canvas->sent_red == NULL)
+    return;
+
+  memcpy(canvas->sent_black, canvas->black, CANVAS_SIZE);
+  memcpy(canvas->sent_red, canvas->red, CANVAS_SIZE);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string.h>
+
+#include <pico/stdlib.h>
+
+#include "display-ws-eink.h"
+
+typedef enum {
+  White,
+  Black,
+  Red,
+  Yellow,
+} colour_t;
+
+/* Drawing onto the black and red planes in native panel orientation
+ *  Planes are SCREEN_H rows of SCREEN_W bytes, MSB first, with a set bit being White.
+ *  Callers use the rotated (landscape) coordinates of the display_draw_* API:
+ *    x in [0, DISPLAY_H), y in [0, DISPLAY_W)
+ *  which map onto the planes as native column y and native row DISPLAY_H - 1 - x.
+ *  All ranges are half open and clipped silently.
+ *
+ *  Every primitive writes both planes in the same pass: Black inks the black plane
+ *  and whitens the red one, Red (or Yellow) the opposite, and White whitens both.
+ *
+ *  A canvas may cover only a band of native rows [row_start, row_start + rows), its
+ *  planes then hold just those rows and drawing outside of them is clipped. Damage
+ *  tracking and fingerprints need a full screen canvas.
+ */
+
+#define CANVAS_SIZE         (SCREEN_W * SCREEN_H)
+#define CANVAS_MAX_DAMAGE   4     // rectangles reported by canvas_damage()
+#define CANVAS_DAMAGE_GAP   8     // clean rows bridged when merging damaged rows
+
+typedef struct {
+  uint8_t* black;
+  uint8_t* red;
+  uint16_t row_start;
+  uint16_t rows;
+
+  // Copies of the planes as last sent to the panel, NULL when damage is not tracked
+  uint8_t* sent_black;
+  uint8_t* sent_red;
+} Canvas_t;
+
+// Byte aligned region in native panel coordinates, inclusive of the end row and byte
+typedef struct {
+  uint8_t byte_start;
+  uint8_t byte_end;
+  uint16_t row_start;
+  uint16_t row_end;
+} CanvasRect_t;
+
+void canvas_init(Canvas_t* canvas, uint8_t* black, uint8_t* red, uint16_t row_start, uint16_t rows);
+void canvas_fill(Canvas_t* canvas, colour_t colour);
+void canvas_pixel(Canvas_t* canvas, int16_t x, int16_t y, colour_t colour);
+void canvas_hspan(Canvas_t* canvas, int16_t x0, int16_t x1, int16_t y, colour_t colour);
+void canvas_vspan(Canvas_t* canvas, int16_t x, int16_t y0, int16_t y1, colour_t colour);
+void canvas_fill_rect(Canvas_t* canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, colour_t colour);
+void canvas_rect(Canvas_t* canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, colour_t colour);
+void canvas_line(Canvas_t* canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, colour_t colour);
+uint32_t canvas_fingerprint(const Canvas_t* canvas);
+uint8_t canvas_damage(const Canvas_t* canvas, CanvasRect_t* rects, uint8_t max);
+void canvas_mark_sent(Canvas_t* canvas);
+void canvas_blit(Canvas_t* canvas, int16_t x, int16_t y, const uint8_t* columns, uint8_t w, uint8_t h, colour_t colour, bool opaque);
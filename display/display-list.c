@@ -0,0 +1,92 @@
+#include "display-list.h"
+
+void display_list_reset(DisplayList_t* list) {
+  list->count = 0;
+  list->text_used = 0;
+  list->dropped = 0;
+}
+
+static DisplayCommand_t* display_list_next(DisplayList_t* list) {
+  if(list->count >= DISPLAY_LIST_COMMANDS) {
+    list->dropped++;
+    return NULL;
+  }
+
+  return &list->commands[list->count++];
+}
+
+void display_list_add(DisplayList_t* list, DisplayOp_t op, int16_t x0, int16_t y0, int16_t x1, int16_t y1, colour_t colour) {
+  DisplayCommand_t* command = display_list_next(list);
+  if(command == NULL)
+    return;
+
+  *command = (DisplayCommand_t){ op, colour, x0, y0, x1, y1, 0, NULL };
+}
+
+// Text is copied into the list, x_end is where the last glyph ends (for culling), style is kept in y1
+void display_list_add_text(DisplayList_t* list, const char* text, const struct FontDef* font, int16_t x, int16_t y, int16_t x_end, uint16_t style, colour_t colour) {
+  const uint16_t length = strlen(text) + 1;
+
+  if(list->text_used + length > DISPLAY_LIST_TEXT) {
+    list->dropped++;
+    return;
+  }
+
+  DisplayCommand_t* command = display_list_next(list);
+  if(command == NULL)
+    return;
+
+  memcpy(&list->text[list->text_used], text, length);
+  *command = (DisplayCommand_t){ DisplayOpText, colour, x, y, x_end, style, list->text_used, font };
+  list->text_used += length;
+}
+
+void display_list_add_bitmap(DisplayList_t* list, const NativeBitmap_t* bitmap, int16_t x, int16_t y) {
+  DisplayCommand_t* command = display_list_next(list);
+  if(command == NULL)
+    return;
+
+  *command = (DisplayCommand_t){ DisplayOpBitmap, Black, x, y, x + bitmap->width, y, 0, bitmap };
+}
+
+// Whether a command can touch landscape x in [x_min, x_max)
+bool display_list_in_band(const DisplayCommand_t* command, int16_t x_min, int16_t x_max) {
+  int16_t from = command->x0;
+  int16_t to = command->x1;
+
+  switch(command->op) {
+    case DisplayOpFill:
+      return true;
+    case DisplayOpPixel:
+      to = from;
+      break;
+    case DisplayOpText:
+    case DisplayOpBitmap:
+      to--;
+      break;
+    default:
+      if(to < from) {
+        from = command->x1;
+        to = command->x0;
+      }
+      break;
+  }
+
+  return to >= x_min && from < x_max;
+}
+
+// FNV-1a over the recorded calls, equal lists draw equal frames
+uint32_t display_list_fingerprint(const DisplayList_t* list) {
+  const uint8_t* bytes = (const uint8_t*)list->commands;
+  const uint16_t size = list->count * sizeof(DisplayCommand_t);
+  uint32_t hash = 2166136261u;
+
+  for(uint16_t i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  for(uint16_t i = 0; i < list->text_used; i++) {
+    hash = (hash ^ (uint8_t)list->text[i]) * 16777619u;
+  }
+
+  return hash;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string.h>
+
+#include <pico/stdlib.h>
+
+#include "native-bitmaps.h"
+#include "canvas.h"
+
+#define DISPLAY_LIST_COMMANDS   1024  // enough for a full statistics chart, a command per column and series
+#define DISPLAY_LIST_TEXT       1024  // bytes of text, including terminators
+
+struct FontDef;
+
+typedef enum {
+  DisplayOpFill,
+  DisplayOpPixel,
+  DisplayOpLine,
+  DisplayOpRect,
+  DisplayOpFillRect,
+  DisplayOpText,
+  DisplayOpBitmap,
+} DisplayOp_t;
+
+// One recorded draw call, laid out without padding so lists can be hashed as bytes
+typedef struct {
+  uint8_t op;
+  uint8_t colour;
+  int16_t x0;
+  int16_t y0;
+  int16_t x1;               // text: landscape x past the last glyph
+  int16_t y1;
+  uint16_t text;            // offset into the list's text
+  const void* data;         // font or bitmap
+} DisplayCommand_t;
+
+/* Draw calls recorded for replay, instead of being drawn onto a canvas
+ *  Replaying a list once per band of rows renders a screen of any size with
+ *  a constant amount of RAM, see display_draw_list().
+ */
+typedef struct {
+  uint16_t count;
+  uint16_t text_used;
+  uint16_t dropped;         // calls that did not fit
+  DisplayCommand_t commands[DISPLAY_LIST_COMMANDS];
+  char text[DISPLAY_LIST_TEXT];
+} DisplayList_t;
+
+void display_list_reset(DisplayList_t* list);
+void display_list_add(DisplayList_t* list, DisplayOp_t op, int16_t x0, int16_t y0, int16_t x1, int16_t y1, colour_t colour);
+void display_list_add_text(DisplayList_t* list, const char* text, const struct FontDef* font, int16_t x, int16_t y, int16_t x_end, uint16_t style, colour_t colour);
+void display_list_add_bitmap(DisplayList_t* list, const NativeBitmap_t* bitmap, int16_t x, int16_t y);
+bool display_list_in_band(const DisplayCommand_t* command, int16_t x_min, int16_t x_max);
+uint32_t display_list_fingerprint(const DisplayList_t* list);
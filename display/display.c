@@ -1,12 +1,49 @@
 #include <stdlib.h>
 #include "display.h"
 
-#define SCREEN_W (DISPLAY_W / 8)
-#define SCREEN_H DISPLAY_H
-
 #define SCREEN_BUSY_TIMEOUT 30000
-
-static uint8_t* display_buffer;
+#define SCREEN_BUSY_SETTLE_US 200
+
+// Sequence payloads at least this long go by DMA
+#define DISPLAY_SEQ_DMA_MIN       16
+
+// Native rows rendered and streamed at a time by display_draw_list()
+#define DISPLAY_BAND_ROWS         16
+
+// Granularity of the partial refresh (ghosting) counters
+#define DISPLAY_GHOST_TILE_ROWS   8
+#define DISPLAY_GHOST_TILE_BYTES  4
+
+static const PanelDriver_t* display_panel;
+static Canvas_t* display_canvas;
+static DisplayList_t* display_list;     // recording, instead of drawing onto display_canvas
+
+// Band buffers, one is rendered while the other is streamed
+static uint8_t display_band_black[2][DISPLAY_BAND_ROWS * SCREEN_W];
+static uint8_t display_band_red[2][DISPLAY_BAND_ROWS * SCREEN_W];
+static const uint8_t* display_band_pending_red;
+static CanvasRect_t display_band_window;
+
+// DMA framebuffer transfer state
+static int display_dma_channel = -1;
+static volatile bool display_dma_busy;
+static display_callback_t display_dma_callback;
+static uint8_t display_dma_fill_value;
+
+// BUSY pin wait state
+static volatile bool display_busy;
+static volatile bool display_busy_timed_out;
+static display_callback_t display_busy_callback;
+static alarm_id_t display_busy_alarm;
+static uint64_t display_busy_since;
+static uint64_t display_busy_last_us;
+
+// Panel power state, see display_power_down()
+static DisplayPower_t display_power = DisplayPowerDeepSleep;
+static uint32_t display_standby_max_ms;
+static uint64_t display_standby_since;
+static uint32_t display_power_wakes[DisplayPowerCount];
+static uint32_t display_power_wake_us[DisplayPowerCount];
 
 static FontDef_t* font_normal = &FontNormal;
 static FontDef_t* font_title = &FontTitle;
@@ -21,6 +58,8 @@ void display_reset() {
 }
 
 void display_send_command(uint8_t reg) {
+  display_wait_transfer();
+
   gpio_put(SPI_PIN_DC, 0);
   gpio_put(SPI_PIN_CS, 0);
   spi_write_blocking(SPI_PORT, &reg, 1);
@@ -28,32 +67,161 @@ void display_send_command(uint8_t reg) {
 }
 
 void display_send_data(uint8_t data) {
+  display_wait_transfer();
+
   gpio_put(SPI_PIN_DC, 1);
   gpio_put(SPI_PIN_CS, 0);
   spi_write_blocking(SPI_PORT, &data, 1);
   gpio_put(SPI_PIN_CS, 1);
 }
 
-void display_read_busy() {
-  uint8_t busy;
-  uint32_t timeout = 0;
+// Send a command and its payload in a single CS assertion, long payloads by DMA
+void display_send_payload(uint8_t command, const uint8_t* data, uint8_t size) {
+  if(size >= DISPLAY_SEQ_DMA_MIN) {
+    display_send_dma(command, data, size, true, NULL);
+    return;
+  }
 
-  printf("EPD busy...");
-  do {
-    display_send_command(EPD_GET_STATUS);
-    busy = gpio_get(SPI_PIN_BSY);
-    busy = !(busy & 0x01);
-
-    busy_wait_ms(1);
-    timeout += 1;
-    if(timeout > SCREEN_BUSY_TIMEOUT) {
-      printf("Timed out, forcing reset!\n");
-      display_wake();
-      break;
+  display_wait_transfer();
+
+  gpio_put(SPI_PIN_DC, 0);
+  gpio_put(SPI_PIN_CS, 0);
+  spi_write_blocking(SPI_PORT, &command, 1);
+  gpio_put(SPI_PIN_DC, 1);
+  spi_write_blocking(SPI_PORT, data, size);
+  gpio_put(SPI_PIN_CS, 1);
+}
+
+// Run a table of command entries, see DISPLAY_SEQ_DELAY
+void display_send_sequence(const uint8_t* sequence, uint16_t size) {
+  const uint8_t* end = sequence + size;
+
+  while(sequence < end) {
+    const uint8_t command = sequence[0];
+    const uint8_t flags = sequence[1];
+    const uint8_t length = flags & DISPLAY_SEQ_LENGTH;
+
+    display_send_payload(command, &sequence[2], length);
+    sequence += 2 + length;
+
+    if(flags & DISPLAY_SEQ_BUSY) {
+      display_wait_transfer();
+      display_read_busy();
     }
+    if(flags & DISPLAY_SEQ_DELAY) {
+      display_wait_transfer();
+      busy_wait_ms(*sequence++);
+    }
+  }
+}
+
+static void display_busy_done(bool timed_out) {
+  uint32_t irq_state = save_and_disable_interrupts();
+
+  if(!display_busy) {
+    restore_interrupts(irq_state);
+    return;
+  }
+
+  gpio_set_irq_enabled(SPI_PIN_BSY, GPIO_IRQ_EDGE_RISE, false);
+  if(display_busy_alarm > 0) {
+    cancel_alarm(display_busy_alarm);
+    display_busy_alarm = 0;
+  }
+
+  display_busy_last_us = time_us_64() - display_busy_since;
+  display_busy_timed_out = timed_out;
+  display_busy = false;
+
+  display_callback_t callback = display_busy_callback;
+  display_busy_callback = NULL;
+  restore_interrupts(irq_state);
+
+  if(callback)
+    callback();
+}
+
+// BUSY is active low, so the rising edge marks the end of the operation
+static void display_busy_irq_handler() {
+  if(gpio_get_irq_event_mask(SPI_PIN_BSY) & GPIO_IRQ_EDGE_RISE) {
+    gpio_acknowledge_irq(SPI_PIN_BSY, GPIO_IRQ_EDGE_RISE);
+    display_busy_done(false);
+  }
+}
+
+static int64_t display_busy_timeout_callback(alarm_id_t id, void* user_data) {
+  uint32_t irq_state = save_and_disable_interrupts();
+
+  // the alarm of an earlier wait, which ended before it could be cancelled
+  if(id != display_busy_alarm) {
+    restore_interrupts(irq_state);
+    return 0;
+  }
+  display_busy_alarm = 0;
+  restore_interrupts(irq_state);
+
+  display_busy_done(true);
+
+  return 0;
+}
+
+// Get notified through done (in IRQ context) once the panel releases BUSY
+void display_wait_busy_async(display_callback_t done) {
+  if(!display_panel->has_busy) {
+    display_busy_last_us = 0;
+    display_busy_timed_out = false;
+    if(done)
+      done();
+    return;
+  }
+
+  // let the controller pull BUSY low for the command just sent
+  busy_wait_us_32(SCREEN_BUSY_SETTLE_US);
+  if(display_panel->status)
+    display_panel->status();
+
+  display_busy_since = time_us_64();
+  display_busy_callback = done;
+  display_busy_timed_out = false;
+
+  // arm the timeout before the edge can end the wait, so whichever ends it clears the other
+  uint32_t irq_state = save_and_disable_interrupts();
+  display_busy = true;
+  display_busy_alarm = add_alarm_in_ms(SCREEN_BUSY_TIMEOUT, display_busy_timeout_callback, NULL, true);
+  gpio_acknowledge_irq(SPI_PIN_BSY, GPIO_IRQ_EDGE_RISE);
+  gpio_set_irq_enabled(SPI_PIN_BSY, GPIO_IRQ_EDGE_RISE, true);
+  restore_interrupts(irq_state);
+
+  // already idle, the edge may have come and gone
+  if(gpio_get(SPI_PIN_BSY))
+    display_busy_done(false);
+}
+
+bool display_is_busy() {
+  return display_busy;
+}
+
+// Sleep the core until the panel is idle
+void display_read_busy() {
+  printf("EPD busy...");
+  display_wait_busy_async(NULL);
+
+  while(display_busy)
+    __wfe();
+
+  if(display_busy_timed_out) {
+    printf("Timed out, forcing reset!\n");
+    display_wake();
+    return;
   }
-  while(busy);
-  printf("Done.\n");
+
+  // the core sleeps in WFE for the whole wait, instead of polling every 1ms
+  printf("Done in %lluus (~%llu cycles slept).\n",
+      display_busy_last_us, display_busy_last_us * (clock_get_hz(clk_sys) / 1000000));
+}
+
+uint64_t display_busy_duration_us() {
+  return display_busy_last_us;
 }
 
 void display_gpio_init() {
@@ -68,17 +236,119 @@ void display_gpio_init() {
 
   gpio_init(SPI_PIN_BSY);
   gpio_set_dir(SPI_PIN_BSY, GPIO_IN);
+  gpio_add_raw_irq_handler(SPI_PIN_BSY, display_busy_irq_handler);
+  irq_set_enabled(IO_IRQ_BANK0, true);
+
+  gpio_put(SPI_PIN_CS, 1);
+}
+
+void display_dma_irq_handler() {
+  if(display_dma_channel < 0 || !dma_channel_get_irq0_status(display_dma_channel))
+    return;
+
+  dma_channel_acknowledge_irq0(display_dma_channel);
 
+  // DMA is done once the last byte is in the FIFO, let it drain before releasing CS
+  while(spi_is_busy(SPI_PORT))
+    tight_loop_contents();
+  while(spi_is_readable(SPI_PORT))
+    (void)spi_get_hw(SPI_PORT)->dr;
+  spi_get_hw(SPI_PORT)->icr = SPI_SSPICR_RORIC_BITS;
+
+  gpio_put(SPI_PIN_CS, 1);
+  display_dma_busy = false;
+
+  if(display_dma_callback) {
+    display_callback_t callback = display_dma_callback;
+    display_dma_callback = NULL;
+    callback();
+  }
+}
+
+int display_dma_init() {
+  display_dma_channel = dma_claim_unused_channel(false);
+  if(display_dma_channel < 0) {
+    printf("Unable to claim a DMA channel for the display\n");
+    return -1;
+  }
+
+  dma_channel_set_irq0_enabled(display_dma_channel, true);
+  irq_add_shared_handler(DMA_IRQ_0, display_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_0, true);
+
+  return 0;
+}
+
+// Stream size bytes after a command in a single CS assertion, incrementing through source or repeating it
+void display_send_dma(uint8_t command, const uint8_t* source, uint16_t size, bool increment, display_callback_t done) {
+  display_send_command(command);
+
+  display_dma_busy = true;
+  display_dma_callback = done;
+
+  gpio_put(SPI_PIN_DC, 1);
+  gpio_put(SPI_PIN_CS, 0);
+
+  dma_channel_config config = dma_channel_get_default_config(display_dma_channel);
+  channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+  channel_config_set_read_increment(&config, increment);
+  channel_config_set_write_increment(&config, false);
+  channel_config_set_dreq(&config, spi_get_dreq(SPI_PORT, true));
+
+  dma_channel_configure(display_dma_channel, &config, &spi_get_hw(SPI_PORT)->dr, source, size, true);
+}
+
+void display_wait_transfer() {
+  while(display_dma_busy)
+    __wfe();
+}
+
+bool display_is_transferring() {
+  return display_dma_busy;
+}
+
+// Stream the rows of region (NULL for the whole screen) after a command, data holds rows of stride bytes
+void display_send_rows(uint8_t command, const uint8_t* data, uint16_t stride, const CanvasRect_t* region, display_callback_t done) {
+  if(region == NULL) {
+    display_send_dma(command, data, SCREEN_W * SCREEN_H, true, done);
+    return;
+  }
+
+  const uint16_t line_bytes = region->byte_end - region->byte_start + 1;
+  const uint16_t rows = region->row_end - region->row_start + 1;
+
+  // whole rows are contiguous, and can go by DMA
+  if(line_bytes == stride) {
+    display_send_dma(command, data, line_bytes * rows, true, done);
+    return;
+  }
+
+  display_send_command(command);
+  gpio_put(SPI_PIN_DC, 1);
+  gpio_put(SPI_PIN_CS, 0);
+  for(uint16_t row = 0; row < rows; row++) {
+    spi_write_blocking(SPI_PORT, &data[row * stride + region->byte_start], line_bytes);
+  }
   gpio_put(SPI_PIN_CS, 1);
+
+  if(done)
+    done();
 }
 
-int display_init() {
+int display_init(const PanelDriver_t* panel) {
+  display_panel = panel;
+  printf("Display panel: %s\n", panel->name);
+
   display_gpio_init();
 
   spi_init(SPI_PORT, SPI_BD);
   gpio_set_function(SPI_PIN_CLK, GPIO_FUNC_SPI);
   gpio_set_function(SPI_PIN_DIN, GPIO_FUNC_SPI);
 
+  if(display_dma_init() != 0) {
+    return -1;
+  }
+
   printf("SPI Device initialised\n");
 
   display_wake();
@@ -88,161 +358,177 @@ int display_init() {
   return 0;
 }
 
-void display_set_buffer(uint8_t* buffer) {
-  display_buffer = buffer;
+void display_set_canvas(Canvas_t* canvas) {
+  display_canvas = canvas;
 }
 
-void display_draw_pixel(uint16_t x_start, uint16_t y_start, colour_t colour) {
-  // translate 270 degrees
-  const uint16_t x = y_start;
-  const uint16_t y = DISPLAY_H - x_start - 1;
+// Record the display_draw_* calls into list until called again with NULL
+void display_set_list(DisplayList_t* list) {
+  if(list != NULL)
+    display_list_reset(list);
 
-  if(x > DISPLAY_W || y > DISPLAY_H) {
-    printf("Pixel outside bounds (%d, %d)\n", x, y);
+  display_list = list;
+}
+
+void display_draw_pixel(uint16_t x, uint16_t y, colour_t colour) {
+  if(display_list) {
+    display_list_add(display_list, DisplayOpPixel, x, y, x, y, colour);
     return;
   }
+  canvas_pixel(display_canvas, x, y, colour);
+}
 
-  uint32_t addr = x / 8 + y * SCREEN_W;
-  uint8_t data;
+void display_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, colour_t colour) {
+  if(display_list) {
+    display_list_add(display_list, DisplayOpLine, x0, y0, x1, y1, colour);
+    return;
+  }
+  canvas_line(display_canvas, x0, y0, x1, y1, colour);
+}
 
-  switch(colour) {
-    case Black:
-    case Red:
-    case Yellow:
-      data = display_buffer[addr];
-      display_buffer[addr] = data & ~(0x80 >> (x % 8));
-      break;
-    case White:
-      data = display_buffer[addr];
-      display_buffer[addr] = data | (0x80 >> (x % 8));
-      break;
-    default:
-      printf("No colour selected for pixel (%d, %d)\n", x, y);
-      break;
+void display_draw_rect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, colour_t colour) {
+  if(display_list) {
+    display_list_add(display_list, DisplayOpRect, x1, y1, x2, y2, colour);
+    return;
   }
+  canvas_rect(display_canvas, x1, y1, x2, y2, colour);
 }
-void display_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
-  const int16_t steep = abs(y1 - y0) > abs(x1 - x0);
-  if(steep) {
-    int16_t t = x0;
-    x0 = y0;
-    y0 = t;
 
-    t = x1;
-    x1 = y1;
-    y1 = t;
+void display_draw_fill(int16_t x1, int16_t y1, int16_t x2, int16_t y2, colour_t colour) {
+  if(display_list) {
+    display_list_add(display_list, DisplayOpFillRect, x1, y1, x2, y2, colour);
+    return;
+  }
+  canvas_fill_rect(display_canvas, x1, y1, x2, y2, colour);
+}
 
-    if (x0 > x1) {
-      t = x0;
-      x0 = x1;
-      x1 = t;
+// Landscape x past the last glyph of text
+static uint16_t display_font_end(const char* text, const FontDef_t* font, uint16_t x, uint8_t scale) {
+  return x + font_text_width(font, text) * scale;
+}
 
-      t = y0;
-      y0 = y1;
-      y1 = t;
-    }
-  }
+// Column c of a decoded glyph, the top row in bit 31, 0 outside the glyph
+inline static uint32_t display_glyph_column(const FontIterator_t* glyphs, uint8_t column_bytes, int16_t c) {
+  uint32_t column = 0;
 
-  const int dx = x1 - x0;
-  const int dy = abs(y1 - y0);
-  int16_t err = dx / 2;
-  const int16_t ystep = (y0 < y1) ? 1 : -1;
+  if(c < 0 || c >= glyphs->width)
+    return 0;
 
-  for(; x0 <= x1; x0++) {
-    if(steep) {
-      if(y0 > DISPLAY_H || x0 > DISPLAY_W) {
-        printf("Steep line trying to be drawn outside screen (%d, %d)\n", x0, y0);
-        return;
-      }
-      display_draw_pixel(y0, x0, Black);
-    } else {
-      if(x0 > DISPLAY_H || y0 > DISPLAY_W) {
-        printf("Line trying to be drawn outside screen (%d, %d)\n", x0, y0);
-        return;
-      }
-      display_draw_pixel(x0, y0, Black);
-    }
-    err -= dy;
-    if(err < 0) {
-      y0 += ystep;
-      err += dx;
-    }
+  for(uint8_t b = 0; b < column_bytes; b++) {
+    column |= (uint32_t)glyphs->columns[c * column_bytes + b] << (24 - b * 8);
   }
+  return column;
 }
 
-void display_draw_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-  display_draw_line(x1, y1, x2, y1);
-  display_draw_line(x1, y2, x2, y2);
-  display_draw_line(x1, y1, x1, y2);
-  display_draw_line(x2, y1, x2, y2);
+// Span rows [from, to) of each glyph row set in rows, scaled, in one native row
+static void display_scaled_rows(int16_t x, int16_t y, uint32_t rows, uint8_t scale, uint8_t from, uint8_t to, colour_t colour) {
+  while(rows) {
+    const uint8_t r = __builtin_clz(rows);
+    rows &= ~(0x80000000u >> r);
+    canvas_vspan(display_canvas, x, y + r * scale + from, y + r * scale + to, colour);
+  }
 }
 
-void display_draw_fill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-  for(uint16_t x = x1; x < x2; x++) {
-    for(uint16_t y = y1; y < y2; y++) {
-      display_draw_pixel(x, y, Black);
+/* Draw a decoded glyph scale times larger, as vertical spans
+ *  Each glyph column becomes scale native rows, each run of set bits one span.
+ *  Smoothing fills half of the empty cells on either side of a diagonal step
+ *  (two cells touching only at a corner, with the other two empty), found for
+ *  a whole column at once with a few shifts and masks of its neighbours.
+ */
+static void display_blit_scaled(const FontIterator_t* glyphs, int16_t x, int16_t y, uint8_t height, uint8_t scale, bool smooth, colour_t colour) {
+  const uint8_t column_bytes = (height + 7) / 8;
+  const uint32_t rows = ~(UINT32_MAX >> height);
+  uint32_t previous = 0;
+  uint32_t current = display_glyph_column(glyphs, column_bytes, 0);
+
+  // opaque, like canvas_blit() of unscaled glyphs
+  canvas_fill_rect(display_canvas, x, y, x + glyphs->width * scale, y + height * scale, White);
+
+  for(int16_t c = 0; c < glyphs->width; c++, x += scale) {
+    const uint32_t next = display_glyph_column(glyphs, column_bytes, c + 1);
+    const uint32_t empty = smooth ? ~current & rows : 0;
+
+    // empty cells with a diagonal step through a corner, << 1 is the row below
+    const uint32_t bottom_left = empty & previous & (current << 1) & ~(previous << 1);
+    const uint32_t bottom_right = empty & next & (current << 1) & ~(next << 1);
+    const uint32_t top_left = empty & previous & (current >> 1) & ~(previous >> 1);
+    const uint32_t top_right = empty & next & (current >> 1) & ~(next >> 1);
+
+    for(uint8_t i = 0; i < scale; i++) {
+      uint32_t bits = current;
+
+      while(bits) {
+        const uint8_t r0 = __builtin_clz(bits);
+        const uint32_t run = ~(bits << r0);
+        const uint8_t r1 = r0 + (run == 0 ? 32 - r0 : __builtin_clz(run));
+
+        canvas_vspan(display_canvas, x + i, y + r0 * scale, y + r1 * scale, colour);
+        bits = r1 >= 32 ? 0 : bits & (UINT32_MAX >> r1);
+      }
+
+      // triangles of each corner cell, split along the step's diagonal
+      display_scaled_rows(x + i, y, bottom_left, scale, i + 1, scale, colour);
+      display_scaled_rows(x + i, y, top_left, scale, 0, scale - 1 - i, colour);
+      display_scaled_rows(x + i, y, bottom_right, scale, scale - i, scale, colour);
+      display_scaled_rows(x + i, y, top_right, scale, 0, i, colour);
     }
+
+    previous = current;
+    current = next;
   }
 }
 
-char display_draw_char(uint16_t x, uint16_t y, char ch, FontDef_t* font, colour_t colour) {
-  uint16_t page, col;
+/* Draw text glyph by glyph, returns the first character missing from the font (0 if none)
+ *  style is the integer scale, DISPLAY_TEXT_SMOOTH smooths the diagonals of scaled glyphs.
+ */
+char display_draw_font_scaled(char* text, FontDef_t* font, uint16_t x, uint16_t y, uint16_t style, colour_t colour) {
+  const uint8_t scale = style & DISPLAY_TEXT_SCALE;
+  FontIterator_t glyphs;
 
-  if(x > DISPLAY_H || y > DISPLAY_W) {
-    printf("Character trying to be drawn outside screen (%d, %d): '%c'\n", x, y, ch);
+  if(display_list) {
+    display_list_add_text(display_list, text, font, x, y, display_font_end(text, font, x, scale), style, colour);
     return 0;
   }
 
-  uint32_t char_offset = (ch - ' ') * font->font_height * (font->font_width / 8 + (font->font_width % 8 ? 1 : 0));
-  const unsigned char *ptr = &font->data[char_offset];
-
-  for(page = 0; page < font->font_height; page++) {
-    for(col = 0; col < font->font_width; col++) {
-      if(*ptr & (0x80 >> (col % 8))) {
-        display_draw_pixel(x + col, y + page, colour);
-      } else {
-        display_draw_pixel(x + col, y + page, White);
-      }
-      if(col % 8 == 7)
-        ptr++;
+  if(scale <= 1) {
+    font_iterator_init(&glyphs, font, text, x, y);
+    while(font_iterator_next(&glyphs, true)) {
+      canvas_blit(display_canvas, glyphs.x, glyphs.y, glyphs.columns, glyphs.width, font->font_height, colour, true);
     }
-    if(font->font_width % 8 != 0)
-      ptr++;
+    return glyphs.missing;
   }
 
-  return ch;
+  // glyphs are laid out unscaled from 0, 0 and scaled into place
+  font_iterator_init(&glyphs, font, text, 0, 0);
+  while(font_iterator_next(&glyphs, true)) {
+    display_blit_scaled(&glyphs, x + glyphs.x * scale, y + glyphs.y * scale, font->font_height, scale,
+        style & DISPLAY_TEXT_SMOOTH, colour);
+  }
+
+  return glyphs.missing;
 }
 
 char display_draw_font(char* text, FontDef_t* font, uint16_t x, uint16_t y, colour_t colour) {
-  uint16_t current_x = x;
-
-  while(*text) {
-    if(*text == '\n') {
-      y += font->font_height;
-      text++;
-      continue;
-    }
-    if(*text == '\t') {
-      current_x += font->font_width * 2;
-      text++;
-      continue;
-    }
-
-    if(display_draw_char(current_x, y, *text, font, colour) != *text) {
-      return *text;
-    }
+  return display_draw_font_scaled(text, font, x, y, 1, colour);
+}
 
-    // increment to next character, and associated character width
-    text++;
-    current_x += font->font_width;
-  }
+uint16_t display_text_width(const char* text) {
+  return font_text_width(font_normal, text);
 }
 
 char display_draw_text(char* text, uint16_t x, uint16_t y, colour_t colour) {
-  display_draw_font(text, font_normal, x, y, colour);
+  return display_draw_font(text, font_normal, x, y, colour);
 }
 char display_draw_title(char* text, uint16_t x, uint16_t y, colour_t colour) {
-  display_draw_font(text, font_title, x, y, colour);
+  return display_draw_font(text, font_title, x, y, colour);
+}
+
+void display_draw_bitmap(int16_t x, int16_t y, const NativeBitmap_t* bitmap) {
+  if(display_list) {
+    display_list_add_bitmap(display_list, bitmap, x, y);
+    return;
+  }
+  canvas_blit(display_canvas, x, y, bitmap->data, bitmap->width, bitmap->height, Black, false);
 }
 
 void display_draw_xbitmap(int16_t x_point, uint16_t y_point, uint16_t w, uint16_t h, const uint8_t bitmap[]) {
@@ -262,111 +548,272 @@ void display_draw_xbitmap(int16_t x_point, uint16_t y_point, uint16_t w, uint16_
   }
 }
 
+// Repeat value for every byte of the screen after command
 void display_send_fill(const uint8_t command, const uint8_t value) {
-  const uint16_t size = SCREEN_H * SCREEN_W;
+  display_wait_transfer();
+  display_dma_fill_value = value;
 
-  display_send_command(command);
-  for(uint16_t i = 0; i < size; i++) {
-    display_send_data(value);
-  }
+  display_send_dma(command, &display_dma_fill_value, SCREEN_H * SCREEN_W, false, NULL);
 }
 
 void display_clear() {
   printf("Clearing screen: ");
-  display_send_fill(EPD_DATA_START_TRANSMISSION_1, 0xff);
-  display_send_fill(EPD_DATA_START_TRANSMISSION_2, 0xff);
+  display_panel->fill(0, 0xff);
+  display_panel->fill(1, 0xff);
+  display_wait_transfer();
   display_refresh(true);
 }
 
 void display_fill_colour(colour_t colour) {
-  uint8_t colour_value = (colour == White) ? 0xff : 0x00;
+  if(display_list) {
+    display_list_add(display_list, DisplayOpFill, 0, 0, 0, 0, colour);
+    return;
+  }
+  canvas_fill(display_canvas, colour);
+}
+
+// Replay the commands of list that can touch band onto it
+static void display_render_band(const DisplayList_t* list, Canvas_t* band) {
+  const int16_t x_min = DISPLAY_H - band->row_start - band->rows;
+  const int16_t x_max = DISPLAY_H - band->row_start;
+  Canvas_t* canvas = display_canvas;
+
+  display_canvas = band;
+  for(uint16_t i = 0; i < list->count; i++) {
+    const DisplayCommand_t* command = &list->commands[i];
+    if(!display_list_in_band(command, x_min, x_max))
+      continue;
 
-  for(uint16_t i = 0; i < SCREEN_W * SCREEN_H; i++) {
-    display_buffer[i] = colour_value;
+    switch(command->op) {
+      case DisplayOpFill:
+        canvas_fill(band, command->colour);
+        break;
+      case DisplayOpPixel:
+        canvas_pixel(band, command->x0, command->y0, command->colour);
+        break;
+      case DisplayOpLine:
+        canvas_line(band, command->x0, command->y0, command->x1, command->y1, command->colour);
+        break;
+      case DisplayOpRect:
+        canvas_rect(band, command->x0, command->y0, command->x1, command->y1, command->colour);
+        break;
+      case DisplayOpFillRect:
+        canvas_fill_rect(band, command->x0, command->y0, command->x1, command->y1, command->colour);
+        break;
+      case DisplayOpText:
+        display_draw_font_scaled((char*)&list->text[command->text], (FontDef_t*)command->data,
+            command->x0, command->y0, command->y1, command->colour);
+        break;
+      case DisplayOpBitmap:
+        display_draw_bitmap(command->x0, command->y0, (const NativeBitmap_t*)command->data);
+        break;
+    }
   }
+  display_canvas = canvas;
 }
 
-void display_send_buffer(const uint8_t* buffer, int w, int h, int dtm) {
-  uint16_t size = w * h;
-  uint8_t cmd = (dtm == 1)
-    ? EPD_DATA_START_TRANSMISSION_1
-    : EPD_DATA_START_TRANSMISSION_2;
+// Chained from the end of a band's black plane transfer, in IRQ context
+static void display_send_band_red() {
+  display_panel->write(1, display_band_pending_red, SCREEN_W, NULL);
+}
 
-  display_send_command(cmd);
-  for(uint16_t i = 0; i < size; i++) {
-    display_send_data(buffer[i]);
+/* Render list a band of DISPLAY_BAND_ROWS native rows at a time, and stream each
+ *  band into its window of the panel's RAM. While one band is transferred by DMA
+ *  the next is rendered into the other band buffer. The caller refreshes afterwards.
+ */
+void display_draw_list(const DisplayList_t* list) {
+  DisplayList_t* recording = display_list;
+  Canvas_t band;
+  uint8_t current = 0;
+
+  if(list->dropped > 0) {
+    printf("Display list is missing %d draw calls\n", list->dropped);
   }
+
+  display_list = NULL;
+  canvas_init(&band, display_band_black[current], display_band_red[current], 0,
+      SCREEN_H < DISPLAY_BAND_ROWS ? SCREEN_H : DISPLAY_BAND_ROWS);
+  display_render_band(list, &band);
+
+  for(uint16_t row = 0; row < SCREEN_H; row += DISPLAY_BAND_ROWS) {
+    // waits for the previous band, whose buffer is rendered into next
+    display_wait_transfer();
+    display_band_window = (CanvasRect_t){ 0, SCREEN_W - 1, row, row + band.rows - 1 };
+    display_panel->set_window(&display_band_window);
+
+    display_band_pending_red = display_band_red[current];
+    display_panel->write(0, display_band_black[current], SCREEN_W, display_send_band_red);
+
+    const uint16_t next = row + DISPLAY_BAND_ROWS;
+    if(next < SCREEN_H) {
+      current ^= 1;
+      canvas_init(&band, display_band_black[current], display_band_red[current], next,
+          SCREEN_H - next < DISPLAY_BAND_ROWS ? SCREEN_H - next : DISPLAY_BAND_ROWS);
+      display_render_band(list, &band);
+    }
+  }
+  display_wait_transfer();
+  display_panel->set_window(NULL);
+
+  display_list = recording;
+}
+
+void display_send_buffer_async(const uint8_t* buffer, int w, int h, int dtm, display_callback_t done) {
+  display_panel->write(dtm - 1, buffer, w, done);
 }
 
-uint16_t display_set_partial_window(coord_t region) {
-  region.x &= 0xfff8; // byte boundary
-  region.w = (region.w - 1) | 0x0007; // byte boundary
+void display_send_buffer(const uint8_t* buffer, int w, int h, int dtm) {
+  display_send_buffer_async(buffer, w, h, dtm, NULL);
+  display_wait_transfer();
+}
 
-  display_send_command(EPD_PARTIAL_WINDOW);
-  display_send_data(region.x % 256);
-  display_send_data(region.w % 256);
-  display_send_data(region.y / 256);
-  display_send_data(region.y % 256);
-  display_send_data(region.h / 256);
-  display_send_data(region.h % 256);
-  display_send_data(0x01);
+// Partial refreshes seen by each tile of the panel since the last full refresh
+static uint8_t display_partial_counts[SCREEN_H / DISPLAY_GHOST_TILE_ROWS + 1][SCREEN_W / DISPLAY_GHOST_TILE_BYTES + 1];
 
-  // return number of bytes to transfer per line
-  return (7 + region.w - region.x) / 8;
+#define FOR_EACH_TILE(region, band, group) \
+  for(uint16_t band = (region)->row_start / DISPLAY_GHOST_TILE_ROWS; band <= (region)->row_end / DISPLAY_GHOST_TILE_ROWS; band++) \
+    for(uint8_t group = (region)->byte_start / DISPLAY_GHOST_TILE_BYTES; group <= (region)->byte_end / DISPLAY_GHOST_TILE_BYTES; group++)
+
+// Whether regions can be partially refreshed without any tile passing limit partials
+bool display_partial_allowed(const CanvasRect_t* regions, uint8_t count, uint8_t limit) {
+  for(uint8_t i = 0; i < count; i++) {
+    FOR_EACH_TILE(&regions[i], band, group) {
+      if(display_partial_counts[band][group] >= limit)
+        return false;
+    }
+  }
+  return true;
 }
 
-void display_draw_partial(const uint8_t* black_buffer, const uint8_t* red_buffer, const coord_t region) {
-  display_send_command(EPD_PARTIAL_IN);
-  display_set_partial_window(region);
+// A full refresh clears the ghosting of every tile
+void display_partial_reset() {
+  memset(display_partial_counts, 0, sizeof(display_partial_counts));
+}
 
-  display_send_buffer(black_buffer, SCREEN_W, SCREEN_H, 1);
-  display_send_command(EPD_PARTIAL_OUT);
-  display_send_buffer(red_buffer, SCREEN_W, SCREEN_H, 2);
-  display_send_command(EPD_PARTIAL_OUT);
+// Send and refresh each region, with the panel's fast waveform when it has one
+void display_draw_partial(const uint8_t* black_buffer, const uint8_t* red_buffer, const CanvasRect_t* regions, uint8_t count) {
+  const PanelRefresh_t mode = PANEL_SUPPORTS(display_panel, PanelRefreshFast)
+    ? PanelRefreshFast
+    : PanelRefreshPartial;
+
+  for(uint8_t i = 0; i < count; i++) {
+    const CanvasRect_t* region = &regions[i];
+    const uint16_t offset = region->row_start * SCREEN_W;
+
+    display_panel->set_window(region);
+    display_panel->write(0, &black_buffer[offset], SCREEN_W, NULL);
+    display_panel->write(1, &red_buffer[offset], SCREEN_W, NULL);
+    display_wait_transfer();
+    display_panel->refresh(mode);
+    display_read_busy();
 
-  display_refresh(true);
-  busy_wait_ms(500);
+    FOR_EACH_TILE(region, band, group) {
+      if(display_partial_counts[band][group] < UINT8_MAX)
+        display_partial_counts[band][group]++;
+    }
+  }
+
+  display_panel->set_window(NULL);
 }
 
 void display_refresh(bool wait_busy) {
-  display_send_command(EPD_DISPLAY_REFRESH);
+  display_wait_transfer();
+  display_panel->refresh(PanelRefreshFull);
   if(wait_busy)
     display_read_busy();
 }
 
+// Start a refresh, done is called (in IRQ context) when the panel has finished
+void display_refresh_async(display_callback_t done) {
+  display_wait_transfer();
+  display_panel->refresh(PanelRefreshFull);
+  display_wait_busy_async(done);
+}
+
 void display_sleep() {
-  display_send_command(EPD_POWER_OFF);
-  display_read_busy();
-  display_send_command(EPD_DEEP_SLEEP);
-  display_send_data(EPD_CHECK_CODE);
+  display_panel->sleep();
+  display_power = DisplayPowerDeepSleep;
   printf("Display off and sleeping!\n");
   busy_wait_ms(500);
 }
 
 void display_wake() {
-  display_reset();
+  display_panel->init();
+  display_panel->load_lut(PanelRefreshFull);
+  display_power = DisplayPowerOn;
 
-  display_send_command(EPD_BOOSTER_SOFT_START);
-  display_send_data(0x17);
-  display_send_data(0x17);
-  display_send_data(0x17);
-  display_send_command(EPD_POWER_ON);
+  printf("Display awake!\n");
+}
 
-  display_send_command(EPD_PANEL_SETTING);
-  display_send_data(0x0f);
-  display_send_data(0x89);
+// Longest expected idle time the panel is left in standby for, rather than deep sleep
+void display_set_standby_limit(uint32_t standby_max_ms) {
+  display_standby_max_ms = standby_max_ms;
+}
 
-  //display_send_command(EPD_PLL_CONTROL);
-  //display_send_data(0x3C);
+/* Power the panel down until the next refresh, expected in idle_ms
+ *  Standby (power off) keeps the controller's registers, so waking only needs
+ *  POWER_ON, where deep sleep needs a reset and the whole init sequence. Deep
+ *  sleep draws less, so it is kept for idle periods past the standby limit.
+ */
+void display_power_down(uint32_t idle_ms) {
+  if(display_power != DisplayPowerOn)
+    return;
 
-  display_send_command(EPD_TCON_RESOLUTION);
-  display_send_data(0x80);
-  display_send_data(0x01);
-  display_send_data(0x28);
+  display_wait_transfer();
 
-  display_send_command(EPD_VCOM_AND_DATA_INTERVAL_SETTING);
-  display_send_data(0x77);
+  if(display_panel->power_off != NULL && idle_ms < display_standby_max_ms) {
+    display_panel->power_off();
+    display_power = DisplayPowerStandby;
+    display_standby_since = time_us_64();
+    printf("Display in standby, next refresh in ~%lums\n", idle_ms);
+    return;
+  }
 
-  printf("Display awake!\n");
+  display_sleep();
+}
+
+// Ready the panel for a transfer, from whichever state it was left in
+void display_power_up() {
+  const DisplayPower_t from = display_power;
+  const uint64_t started_at = time_us_64();
+
+  switch(from) {
+    case DisplayPowerOn:
+      return;
+    case DisplayPowerStandby:
+      display_panel->power_on();
+      display_power = DisplayPowerOn;
+      break;
+    default:
+      display_wake();
+      break;
+  }
+
+  display_power_wakes[from]++;
+  display_power_wake_us[from] = time_us_64() - started_at;
+}
+
+// When a panel left in standby should be put into deep sleep, UINT64_MAX if it is not in standby
+uint64_t display_power_deadline() {
+  if(display_power != DisplayPowerStandby)
+    return UINT64_MAX;
+
+  return display_standby_since + (uint64_t)display_standby_max_ms * 1000;
+}
+
+// Deep sleep a panel whose expected refresh did not come within the standby limit
+void display_power_idle(uint64_t now_us) {
+  if(now_us >= display_power_deadline())
+    display_sleep();
+}
+
+DisplayPower_t display_power_state() {
+  return display_power;
+}
+
+void display_power_print_stats() {
+  printf("Panel wakes: %lu from standby (last %luus), %lu from deep sleep (last %luus)\n",
+      display_power_wakes[DisplayPowerStandby], display_power_wake_us[DisplayPowerStandby],
+      display_power_wakes[DisplayPowerDeepSleep], display_power_wake_us[DisplayPowerDeepSleep]);
 }
 
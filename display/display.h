@@ -1,20 +1,23 @@
+#pragma once
+
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
 
 #include <pico/stdlib.h>
 #include <hardware/spi.h>
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#include <hardware/sync.h>
+#include <hardware/clocks.h>
 
 #include "font.h"
 #include "menu-images.h"
+#include "native-bitmaps.h"
 #include "display-ws-eink.h"
-
-typedef enum {
-  White,
-  Black,
-  Red,
-  Yellow,
-} colour_t;
+#include "canvas.h"
+#include "panel.h"
+#include "display-list.h"
 
 typedef struct {
   uint16_t x;
@@ -23,20 +26,71 @@ typedef struct {
   uint16_t h;
 } coord_t;
 
-int display_init();
-void display_set_buffer(uint8_t* buffer);
+typedef enum {
+  DisplayPowerOn,
+  DisplayPowerStandby,        // power off, registers kept
+  DisplayPowerDeepSleep,      // needs a reset and the init sequence
+  DisplayPowerCount,
+} DisplayPower_t;
+
+/* Controller command sequences, for display_send_sequence()
+ *  Each entry is a command, a flags byte holding the payload length, then the
+ *  payload. DISPLAY_SEQ_BUSY waits for the panel after the command, and
+ *  DISPLAY_SEQ_DELAY adds a trailing byte of milliseconds to wait.
+ */
+#define DISPLAY_SEQ_DELAY   0x80
+#define DISPLAY_SEQ_BUSY    0x40
+#define DISPLAY_SEQ_LENGTH  0x3f
+
+// Text styles of display_draw_font_scaled(), an integer scale (1 to 4) and flags
+#define DISPLAY_TEXT_SCALE    0x0f
+#define DISPLAY_TEXT_SMOOTH   0x10
+
+int display_init(const PanelDriver_t* panel);
+void display_set_canvas(Canvas_t* canvas);
+void display_set_list(DisplayList_t* list);
+void display_draw_list(const DisplayList_t* list);
+void display_reset();
+void display_send_command(uint8_t reg);
+void display_send_data(uint8_t data);
+void display_send_payload(uint8_t command, const uint8_t* data, uint8_t size);
+void display_send_sequence(const uint8_t* sequence, uint16_t size);
+void display_send_dma(uint8_t command, const uint8_t* source, uint16_t size, bool increment, display_callback_t done);
+void display_send_rows(uint8_t command, const uint8_t* data, uint16_t stride, const CanvasRect_t* region, display_callback_t done);
+void display_send_fill(const uint8_t command, const uint8_t value);
 void display_send_buffer(const uint8_t* buffer, int w, int h, int dtm);
-void display_draw_partial(const uint8_t* black, const uint8_t* red, const coord_t region);
+void display_send_buffer_async(const uint8_t* buffer, int w, int h, int dtm, display_callback_t done);
+void display_wait_transfer();
+bool display_is_transferring();
+void display_draw_partial(const uint8_t* black, const uint8_t* red, const CanvasRect_t* regions, uint8_t count);
+bool display_partial_allowed(const CanvasRect_t* regions, uint8_t count, uint8_t limit);
+void display_partial_reset();
 void display_draw_pixel(uint16_t x, uint16_t y, colour_t colour);
-void display_draw_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
-void display_draw_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
-void display_draw_fill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void display_draw_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, colour_t colour);
+void display_draw_rect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, colour_t colour);
+void display_draw_fill(int16_t x1, int16_t y1, int16_t x2, int16_t y2, colour_t colour);
 char display_draw_text(char* text, uint16_t x, uint16_t y, colour_t colour);
 char display_draw_title(char* title, uint16_t x, uint16_t y, colour_t colour);
+char display_draw_font(char* text, FontDef_t* font, uint16_t x, uint16_t y, colour_t colour);
+char display_draw_font_scaled(char* text, FontDef_t* font, uint16_t x, uint16_t y, uint16_t style, colour_t colour);
+uint16_t display_text_width(const char* text);
+void display_draw_bitmap(int16_t x, int16_t y, const NativeBitmap_t* bitmap);
 void display_draw_xbitmap(int16_t x_point, uint16_t y_point, uint16_t w, uint16_t h, const uint8_t* bitmap);
 void display_fill_colour(colour_t colour);
 void display_clear();
 void display_refresh(bool wait_busy);
+void display_refresh_async(display_callback_t done);
+void display_wait_busy_async(display_callback_t done);
+void display_read_busy();
+bool display_is_busy();
+uint64_t display_busy_duration_us();
 void display_sleep();
 void display_wake();
+void display_set_standby_limit(uint32_t standby_max_ms);
+void display_power_down(uint32_t idle_ms);
+void display_power_up();
+uint64_t display_power_deadline();
+void display_power_idle(uint64_t now_us);
+DisplayPower_t display_power_state();
+void display_power_print_stats();
 
@@ -1,3433 +1,90 @@
 #include "font.h"
 
-const uint8_t Font12_Table[] = 
-{
-	// @0 ' ' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @12 '!' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @24 '"' (7 pixels wide)
-	0x00, //        
-	0x6C, //  ## ## 
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @36 '#' (7 pixels wide)
-	0x00, //        
-	0x14, //    # # 
-	0x14, //    # # 
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x28, //   # #  
-	0x50, //  # #   
-	0x50, //  # #   
-	0x00, //        
-	0x00, //        
-
-	// @48 '$' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x38, //   ###  
-	0x40, //  #     
-	0x40, //  #     
-	0x38, //   ###  
-	0x48, //  #  #  
-	0x70, //  ###   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-
-	// @60 '%' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x50, //  # #   
-	0x20, //   #    
-	0x0C, //     ## 
-	0x70, //  ###   
-	0x08, //     #  
-	0x14, //    # # 
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @72 '&' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x20, //   #    
-	0x20, //   #    
-	0x54, //  # # # 
-	0x48, //  #  #  
-	0x34, //   ## # 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @84 ''' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @96 '(' (7 pixels wide)
-	0x00, //        
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x08, //     #  
-	0x00, //        
-
-	// @108 ')' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x20, //   #    
-	0x00, //        
-
-	// @120 '*' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x10, //    #   
-	0x28, //   # #  
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @132 '+' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0xFE, // #######
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @144 ',' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x10, //    #   
-	0x30, //   ##   
-	0x20, //   #    
-	0x00, //        
-
-	// @156 '-' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @168 '.' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @180 '/' (7 pixels wide)
-	0x00, //        
-	0x04, //      # 
-	0x04, //      # 
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x20, //   #    
-	0x40, //  #     
-	0x00, //        
-	0x00, //        
-
-	// @192 '0' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @204 '1' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @216 '2' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x04, //      # 
-	0x08, //     #  
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @228 '3' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x04, //      # 
-	0x18, //    ##  
-	0x04, //      # 
-	0x04, //      # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @240 '4' (7 pixels wide)
-	0x00, //        
-	0x0C, //     ## 
-	0x14, //    # # 
-	0x14, //    # # 
-	0x24, //   #  # 
-	0x44, //  #   # 
-	0x7E, //  ######
-	0x04, //      # 
-	0x0E, //     ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @252 '5' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x20, //   #    
-	0x20, //   #    
-	0x38, //   ###  
-	0x04, //      # 
-	0x04, //      # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @264 '6' (7 pixels wide)
-	0x00, //        
-	0x1C, //    ### 
-	0x20, //   #    
-	0x40, //  #     
-	0x78, //  ####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @276 '7' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x04, //      # 
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @288 '8' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @300 '9' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x08, //     #  
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @312 ':' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @324 ';' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x18, //    ##  
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x30, //   ##   
-	0x20, //   #    
-	0x00, //        
-	0x00, //        
-
-	// @336 '<' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x0C, //     ## 
-	0x10, //    #   
-	0x60, //  ##    
-	0x80, // #      
-	0x60, //  ##    
-	0x10, //    #   
-	0x0C, //     ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @348 '=' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @360 '>' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0xC0, // ##     
-	0x20, //   #    
-	0x18, //    ##  
-	0x04, //      # 
-	0x18, //    ##  
-	0x20, //   #    
-	0xC0, // ##     
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @372 '?' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x24, //   #  # 
-	0x04, //      # 
-	0x08, //     #  
-	0x10, //    #   
-	0x00, //        
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @384 '@' (7 pixels wide)
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x4C, //  #  ## 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x4C, //  #  ## 
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-
-	// @396 'A' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x28, //   # #  
-	0x28, //   # #  
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @408 'B' (7 pixels wide)
-	0x00, //        
-	0xF8, // #####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xF8, // #####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @420 'C' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x40, //  #     
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @432 'D' (7 pixels wide)
-	0x00, //        
-	0xF0, // ####   
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x48, //  #  #  
-	0xF0, // ####   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @444 'E' (7 pixels wide)
-	0x00, //        
-	0xFC, // ###### 
-	0x44, //  #   # 
-	0x50, //  # #   
-	0x70, //  ###   
-	0x50, //  # #   
-	0x40, //  #     
-	0x44, //  #   # 
-	0xFC, // ###### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @456 'F' (7 pixels wide)
-	0x00, //        
-	0x7E, //  ######
-	0x22, //   #   #
-	0x28, //   # #  
-	0x38, //   ###  
-	0x28, //   # #  
-	0x20, //   #    
-	0x20, //   #    
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @468 'G' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x4E, //  #  ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @480 'H' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @492 'I' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @504 'J' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @516 'K' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x48, //  #  #  
-	0x50, //  # #   
-	0x70, //  ###   
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0xE6, // ###  ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @528 'L' (7 pixels wide)
-	0x00, //        
-	0x70, //  ###   
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @540 'M' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x6C, //  ## ## 
-	0x6C, //  ## ## 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @552 'N' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x64, //  ##  # 
-	0x64, //  ##  # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x4C, //  #  ## 
-	0xEC, // ### ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @564 'O' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @576 'P' (7 pixels wide)
-	0x00, //        
-	0x78, //  ####  
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x38, //   ###  
-	0x20, //   #    
-	0x20, //   #    
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @588 'Q' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x1C, //    ### 
-	0x00, //        
-	0x00, //        
-
-	// @600 'R' (7 pixels wide)
-	0x00, //        
-	0xF8, // #####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0xE2, // ###   #
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @612 'S' (7 pixels wide)
-	0x00, //        
-	0x34, //   ## # 
-	0x4C, //  #  ## 
-	0x40, //  #     
-	0x38, //   ###  
-	0x04, //      # 
-	0x04, //      # 
-	0x64, //  ##  # 
-	0x58, //  # ##  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @624 'T' (7 pixels wide)
-	0x00, //        
-	0xFE, // #######
-	0x92, // #  #  #
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @636 'U' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @648 'V' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @660 'W' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @672 'X' (7 pixels wide)
-	0x00, //        
-	0xC6, // ##   ##
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x28, //   # #  
-	0x44, //  #   # 
-	0xC6, // ##   ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @684 'Y' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @696 'Z' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @708 '[' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x38, //   ###  
-	0x00, //        
-
-	// @720 '\' (7 pixels wide)
-	0x00, //        
-	0x40, //  #     
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-
-	// @732 ']' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x38, //   ###  
-	0x00, //        
-
-	// @744 '^' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x28, //   # #  
-	0x44, //  #   # 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @756 '_' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xFE, // #######
-
-	// @768 '`' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @780 'a' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3E, //   #####
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @792 'b' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x58, //  # ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xF8, // #####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @804 'c' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @816 'd' (7 pixels wide)
-	0x00, //        
-	0x0C, //     ## 
-	0x04, //      # 
-	0x34, //   ## # 
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3E, //   #####
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @828 'e' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x40, //  #     
-	0x40, //  #     
-	0x3C, //   #### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @840 'f' (7 pixels wide)
-	0x00, //        
-	0x1C, //    ### 
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @852 'g' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x36, //   ## ##
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x38, //   ###  
-	0x00, //        
-
-	// @864 'h' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x58, //  # ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @876 'i' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x70, //  ###   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @888 'j' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x78, //  ####  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x70, //  ###   
-	0x00, //        
-
-	// @900 'k' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x5C, //  # ### 
-	0x48, //  #  #  
-	0x70, //  ###   
-	0x50, //  # #   
-	0x48, //  #  #  
-	0xDC, // ## ### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @912 'l' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @924 'm' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xE8, // ### #  
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0xFE, // #######
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @936 'n' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xD8, // ## ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @948 'o' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @960 'p' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xD8, // ## ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x40, //  #     
-	0xE0, // ###    
-	0x00, //        
-
-	// @972 'q' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x36, //   ## ##
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x0E, //     ###
-	0x00, //        
-
-	// @984 'r' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x6C, //  ## ## 
-	0x30, //   ##   
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @996 's' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x04, //      # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1008 't' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x22, //   #   #
-	0x1C, //    ### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1020 'u' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xCC, // ##  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x4C, //  #  ## 
-	0x36, //   ## ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1032 'v' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1044 'w' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1056 'x' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xCC, // ##  ## 
-	0x48, //  #  #  
-	0x30, //   ##   
-	0x30, //   ##   
-	0x48, //  #  #  
-	0xCC, // ##  ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1068 'y' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x24, //   #  # 
-	0x28, //   # #  
-	0x18, //    ##  
-	0x10, //    #   
-	0x10, //    #   
-	0x78, //  ####  
-	0x00, //        
-
-	// @1080 'z' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x48, //  #  #  
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1092 '{' (7 pixels wide)
-	0x00, //        
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x00, //        
-
-	// @1104 '|' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-
-	// @1116 '}' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x00, //        
-
-	// @1128 '~' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x24, //   #  # 
-	0x58, //  # ##  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-};
-const uint8_t Font20_Table[] = 
-{
-	// @0 ' ' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @40 '!' (14 pixels wide)
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x02, 0x00, //       #       
-	0x02, 0x00, //       #       
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @80 '"' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1C, 0xE0, //    ###  ###   
-	0x1C, 0xE0, //    ###  ###   
-	0x1C, 0xE0, //    ###  ###   
-	0x08, 0x40, //     #    #    
-	0x08, 0x40, //     #    #    
-	0x08, 0x40, //     #    #    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @120 '#' (14 pixels wide)
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @160 '$' (14 pixels wide)
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x07, 0xE0, //      ######   
-	0x0F, 0xE0, //     #######   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x00, //    ##         
-	0x1F, 0x00, //    #####      
-	0x0F, 0xC0, //     ######    
-	0x00, 0xE0, //         ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0x80, //    ######     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @200 '%' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1C, 0x00, //    ###        
-	0x22, 0x00, //   #   #       
-	0x22, 0x00, //   #   #       
-	0x22, 0x00, //   #   #       
-	0x1C, 0x60, //    ###   ##   
-	0x01, 0xE0, //        ####   
-	0x0F, 0x80, //     #####     
-	0x3C, 0x00, //   ####        
-	0x31, 0xC0, //   ##   ###    
-	0x02, 0x20, //       #   #   
-	0x02, 0x20, //       #   #   
-	0x02, 0x20, //       #   #   
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @240 '&' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0xE0, //       #####   
-	0x0F, 0xE0, //     #######   
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x0F, 0x30, //     ####  ##  
-	0x1F, 0xF0, //    #########  
-	0x19, 0xE0, //    ##  ####   
-	0x18, 0xC0, //    ##   ##    
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @280 ''' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x01, 0x00, //        #      
-	0x01, 0x00, //        #      
-	0x01, 0x00, //        #      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @320 '(' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @360 ')' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @400 '*' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1B, 0x60, //    ## ## ##   
-	0x1F, 0xE0, //    ########   
-	0x07, 0x80, //      ####     
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x0C, 0xC0, //     ##  ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @440 '+' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @480 ',' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x04, 0x00, //      #        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @520 '-' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @560 '.' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @600 '/' (14 pixels wide)
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @640 '0' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x1F, 0xC0, //    #######    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @680 '1' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @720 '2' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x18, 0x00, //    ##         
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @760 '3' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x3F, 0xC0, //   ########    
-	0x30, 0xE0, //   ##    ###   
-	0x00, 0x60, //          ##   
-	0x00, 0xE0, //         ###   
-	0x07, 0xC0, //      #####    
-	0x07, 0xC0, //      #####    
-	0x00, 0xE0, //         ###   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x60, 0xE0, //  ##     ###   
-	0x7F, 0xC0, //  #########    
-	0x3F, 0x80, //   #######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @800 '4' (14 pixels wide)
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x06, 0xC0, //      ## ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0xC0, //   ##    ##    
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0xC0, //         ##    
-	0x03, 0xE0, //       #####   
-	0x03, 0xE0, //       #####   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @840 '5' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1F, 0x80, //    ######     
-	0x1F, 0xC0, //    #######    
-	0x18, 0xE0, //    ##   ###   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xC0, //   ########    
-	0x1F, 0x80, //    ######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @880 '6' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xE0, //       #####   
-	0x0F, 0xE0, //     #######   
-	0x1E, 0x00, //    ####       
-	0x18, 0x00, //    ##         
-	0x38, 0x00, //   ###         
-	0x37, 0x80, //   ## ####     
-	0x3F, 0xC0, //   ########    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xC0, //    #######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @920 '7' (14 pixels wide)
-	0x00, 0x00, //               
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x30, 0x60, //   ##     ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @960 '8' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xC0, //    #######    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1000 '9' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x00, //     ####      
-	0x1F, 0xC0, //    #######    
-	0x38, 0xC0, //   ###   ##    
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xE0, //    ########   
-	0x0F, 0x60, //     #### ##   
-	0x00, 0xE0, //         ###   
-	0x00, 0xC0, //         ##    
-	0x03, 0xC0, //       ####    
-	0x3F, 0x80, //   #######     
-	0x3E, 0x00, //   #####       
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1040 ':' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1080 ';' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x01, 0xC0, //        ###    
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x04, 0x00, //      #        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1120 '<' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x30, //           ##  
-	0x00, 0xF0, //         ####  
-	0x03, 0xC0, //       ####    
-	0x07, 0x00, //      ###      
-	0x1C, 0x00, //    ###        
-	0x78, 0x00, //  ####         
-	0x1C, 0x00, //    ###        
-	0x07, 0x00, //      ###      
-	0x03, 0xC0, //       ####    
-	0x00, 0xF0, //         ####  
-	0x00, 0x30, //           ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1160 '=' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0xF0, //  ###########  
-	0x7F, 0xF0, //  ###########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0xF0, //  ###########  
-	0x7F, 0xF0, //  ###########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1200 '>' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x30, 0x00, //   ##          
-	0x3C, 0x00, //   ####        
-	0x0F, 0x00, //     ####      
-	0x03, 0x80, //       ###     
-	0x00, 0xE0, //         ###   
-	0x00, 0x78, //          #### 
-	0x00, 0xE0, //         ###   
-	0x03, 0x80, //       ###     
-	0x0F, 0x00, //     ####      
-	0x3C, 0x00, //   ####        
-	0x30, 0x00, //   ##          
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1240 '?' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x00, 0x60, //          ##   
-	0x01, 0xC0, //        ###    
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1280 '@' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x0C, 0x80, //     ##  #     
-	0x08, 0x40, //     #    #    
-	0x10, 0x40, //    #     #    
-	0x10, 0x40, //    #     #    
-	0x11, 0xC0, //    #   ###    
-	0x12, 0x40, //    #  #  #    
-	0x12, 0x40, //    #  #  #    
-	0x12, 0x40, //    #  #  #    
-	0x11, 0xC0, //    #   ###    
-	0x10, 0x00, //    #          
-	0x08, 0x00, //     #         
-	0x08, 0x40, //     #    #    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1320 'A' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x03, 0x80, //       ###     
-	0x06, 0xC0, //      ## ##    
-	0x06, 0xC0, //      ## ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0x60, //     ##   ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x30, 0x30, //   ##      ##  
-	0x78, 0x78, //  ####    #### 
-	0x78, 0x78, //  ####    #### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1360 'B' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0x80, //   #######     
-	0x3F, 0xC0, //   ########    
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xE0, //    ########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1400 'C' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x0F, 0xF0, //     ########  
-	0x1C, 0x70, //    ###   ###  
-	0x38, 0x30, //   ###     ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x38, 0x30, //   ###     ##  
-	0x1C, 0x70, //    ###   ###  
-	0x0F, 0xE0, //     #######   
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1440 'D' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0x80, //  ########     
-	0x7F, 0xC0, //  #########    
-	0x30, 0xE0, //   ##    ###   
-	0x30, 0x70, //   ##     ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x70, //   ##     ###  
-	0x30, 0xE0, //   ##    ###   
-	0x7F, 0xC0, //  #########    
-	0x7F, 0x80, //  ########     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1480 'E' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x19, 0x80, //    ##  ##     
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x19, 0x80, //    ##  ##     
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1520 'F' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x19, 0x80, //    ##  ##     
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x19, 0x80, //    ##  ##     
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1560 'G' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x31, 0xF8, //   ##   ###### 
-	0x31, 0xF8, //   ##   ###### 
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x30, //    ##     ##  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1600 'H' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1640 'I' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1680 'J' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0xF8, //       ####### 
-	0x03, 0xF8, //       ####### 
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xC0, //   ########    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1720 'K' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3E, 0xF8, //   ##### ##### 
-	0x3E, 0xF8, //   ##### ##### 
-	0x18, 0xE0, //    ##   ###   
-	0x19, 0x80, //    ##  ##     
-	0x1B, 0x00, //    ## ##      
-	0x1F, 0x00, //    #####      
-	0x1D, 0x80, //    ### ##     
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0x60, //    ##    ##   
-	0x3E, 0x78, //   #####  #### 
-	0x3E, 0x38, //   #####   ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1760 'L' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x30, //     ##    ##  
-	0x0C, 0x30, //     ##    ##  
-	0x0C, 0x30, //     ##    ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1800 'M' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0x78, //  ####    #### 
-	0x78, 0x78, //  ####    #### 
-	0x38, 0x70, //   ###    ###  
-	0x3C, 0xF0, //   ####  ####  
-	0x34, 0xB0, //   ## #  # ##  
-	0x37, 0xB0, //   ## #### ##  
-	0x37, 0xB0, //   ## #### ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x30, 0x30, //   ##      ##  
-	0x7C, 0xF8, //  #####  ##### 
-	0x7C, 0xF8, //  #####  ##### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1840 'N' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x39, 0xF0, //   ###  #####  
-	0x3D, 0xF0, //   #### #####  
-	0x1C, 0x60, //    ###   ##   
-	0x1E, 0x60, //    ####  ##   
-	0x1E, 0x60, //    ####  ##   
-	0x1B, 0x60, //    ## ## ##   
-	0x1B, 0x60, //    ## ## ##   
-	0x19, 0xE0, //    ##  ####   
-	0x19, 0xE0, //    ##  ####   
-	0x18, 0xE0, //    ##   ###   
-	0x3E, 0xE0, //   ##### ###   
-	0x3E, 0x60, //   #####  ##   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1880 'O' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x1C, 0xE0, //    ###  ###   
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1920 'P' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xE0, //   #########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xC0, //    #######    
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1960 'Q' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x1C, 0xE0, //    ###  ###   
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x07, 0xB0, //      #### ##  
-	0x0F, 0xF0, //     ########  
-	0x0C, 0xE0, //     ##  ###   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2000 'R' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xE0, //   #########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xC0, //    #######    
-	0x18, 0xE0, //    ##   ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x70, //    ##    ###  
-	0x3E, 0x38, //   #####   ### 
-	0x3E, 0x18, //   #####    ## 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2040 'S' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0xB0, //     ##### ##  
-	0x1F, 0xF0, //    #########  
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x00, //   ###         
-	0x1F, 0x80, //    ######     
-	0x07, 0xE0, //      ######   
-	0x00, 0x70, //          ###  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x3F, 0xE0, //   #########   
-	0x37, 0xC0, //   ## #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2080 'T' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0xC0, //     ######    
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2120 'U' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2160 'V' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2200 'W' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7C, 0x7C, //  #####   #####
-	0x7C, 0x7C, //  #####   #####
-	0x30, 0x18, //   ##       ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x36, 0xD8, //   ## ## ## ## 
-	0x16, 0xD0, //    # ## ## #  
-	0x1C, 0x70, //    ###   ###  
-	0x1C, 0x70, //    ###   ###  
-	0x1C, 0x70, //    ###   ###  
-	0x18, 0x30, //    ##     ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2240 'X' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x0D, 0x80, //     ## ##     
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2280 'Y' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x0C, 0xC0, //     ##  ##    
-	0x07, 0x80, //      ####     
-	0x07, 0x80, //      ####     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0xC0, //     ######    
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2320 'Z' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xC0, //    ##   ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x60, //     ##   ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2360 '[' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2400 '\' (14 pixels wide)
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2440 ']' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x00, //     ####      
-	0x0F, 0x00, //     ####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0x00, //     ####      
-	0x0F, 0x00, //     ####      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2480 '^' (14 pixels wide)
-	0x00, 0x00, //               
-	0x02, 0x00, //       #       
-	0x07, 0x00, //      ###      
-	0x0D, 0x80, //     ## ##     
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x20, 0x20, //   #       #   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2520 '_' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0xFF, 0xFC, // ##############
-	0xFF, 0xFC, // ##############
-
-	// @2560 '`' (14 pixels wide)
-	0x00, 0x00, //               
-	0x04, 0x00, //      #        
-	0x03, 0x00, //       ##      
-	0x00, 0x80, //         #     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2600 'a' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0xC0, //     ######    
-	0x1F, 0xE0, //    ########   
-	0x00, 0x60, //          ##   
-	0x0F, 0xE0, //     #######   
-	0x1F, 0xE0, //    ########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xF0, //   ##########  
-	0x1F, 0x70, //    ##### ###  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2640 'b' (14 pixels wide)
-	0x00, 0x00, //               
-	0x70, 0x00, //  ###          
-	0x70, 0x00, //  ###          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x37, 0x80, //   ## ####     
-	0x3F, 0xE0, //   #########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x60, //   ###    ##   
-	0x7F, 0xE0, //  ##########   
-	0x77, 0x80, //  ### ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2680 'c' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x30, //    ##     ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x38, 0x30, //   ###     ##  
-	0x1F, 0xF0, //    #########  
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2720 'd' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x70, //          ###  
-	0x00, 0x70, //          ###  
-	0x00, 0x30, //           ##  
-	0x00, 0x30, //           ##  
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1F, 0xF8, //    ########## 
-	0x07, 0xB8, //      #### ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2760 'e' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x30, 0x00, //   ##          
-	0x18, 0x30, //    ##     ##  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2800 'f' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xF0, //       ######  
-	0x07, 0xF0, //      #######  
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2840 'g' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB8, //      #### ### 
-	0x1F, 0xF8, //    ########## 
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x30, //           ##  
-	0x00, 0x70, //          ###  
-	0x0F, 0xE0, //     #######   
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2880 'h' (14 pixels wide)
-	0x00, 0x00, //               
-	0x38, 0x00, //   ###         
-	0x38, 0x00, //   ###         
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1B, 0xC0, //    ## ####    
-	0x1F, 0xE0, //    ########   
-	0x1C, 0x60, //    ###   ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2920 'i' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2960 'j' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0xC0, //        ###    
-	0x3F, 0x80, //   #######     
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3000 'k' (14 pixels wide)
-	0x00, 0x00, //               
-	0x38, 0x00, //   ###         
-	0x38, 0x00, //   ###         
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1B, 0xE0, //    ## #####   
-	0x1B, 0xE0, //    ## #####   
-	0x1B, 0x00, //    ## ##      
-	0x1E, 0x00, //    ####       
-	0x1E, 0x00, //    ####       
-	0x1B, 0x00, //    ## ##      
-	0x19, 0x80, //    ##  ##     
-	0x39, 0xF0, //   ###  #####  
-	0x39, 0xF0, //   ###  #####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3040 'l' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3080 'm' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7E, 0xE0, //  ###### ###   
-	0x7F, 0xF0, //  ###########  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x7B, 0xB8, //  #### ### ### 
-	0x7B, 0xB8, //  #### ### ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3120 'n' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3B, 0xC0, //   ### ####    
-	0x3F, 0xE0, //   #########   
-	0x1C, 0x60, //    ###   ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3160 'o' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3200 'p' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x77, 0x80, //  ### ####     
-	0x7F, 0xE0, //  ##########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x60, //   ###    ##   
-	0x3F, 0xE0, //   #########   
-	0x37, 0x80, //   ## ####     
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x7C, 0x00, //  #####        
-	0x7C, 0x00, //  #####        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3240 'q' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB8, //      #### ### 
-	0x1F, 0xF8, //    ########## 
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x30, //           ##  
-	0x00, 0x30, //           ##  
-	0x00, 0xF8, //         ##### 
-	0x00, 0xF8, //         ##### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3280 'r' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xE0, //   ####  ###   
-	0x3D, 0xF0, //   #### #####  
-	0x0F, 0x30, //     ####  ##  
-	0x0E, 0x00, //     ###       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xC0, //   ########    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3320 's' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xE0, //      ######   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x1E, 0x00, //    ####       
-	0x0F, 0xC0, //     ######    
-	0x01, 0xE0, //        ####   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0x80, //    ######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3360 't' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x30, //     ##    ##  
-	0x0F, 0xF0, //     ########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3400 'u' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x38, 0xE0, //   ###   ###   
-	0x38, 0xE0, //   ###   ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xF0, //    #########  
-	0x0F, 0x70, //     #### ###  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3440 'v' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3480 'w' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x32, 0x60, //   ##  #  ##   
-	0x32, 0x60, //   ##  #  ##   
-	0x37, 0xE0, //   ## ######   
-	0x1D, 0xC0, //    ### ###    
-	0x1D, 0xC0, //    ### ###    
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3520 'x' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x0C, 0xC0, //     ##  ##    
-	0x07, 0x80, //      ####     
-	0x03, 0x00, //       ##      
-	0x07, 0x80, //      ####     
-	0x0C, 0xC0, //     ##  ##    
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3560 'y' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0F, 0x80, //     #####     
-	0x07, 0x00, //      ###      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x7F, 0x00, //  #######      
-	0x7F, 0x00, //  #######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3600 'z' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0xC0, //    ##   ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x60, //     ##   ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3640 '{' (14 pixels wide)
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x03, 0xC0, //       ####    
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x07, 0x00, //      ###      
-	0x0E, 0x00, //     ###       
-	0x07, 0x00, //      ###      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0xC0, //       ####    
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3680 '|' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3720 '}' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1C, 0x00, //    ###        
-	0x1E, 0x00, //    ####       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x07, 0x00, //      ###      
-	0x03, 0x80, //       ###     
-	0x07, 0x00, //      ###      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1E, 0x00, //    ####       
-	0x1C, 0x00, //    ###        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3760 '~' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0E, 0x00, //     ###       
-	0x3F, 0x30, //   ######  ##  
-	0x33, 0xF0, //   ##  ######  
-	0x01, 0xE0, //        ####   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-};
-
-FontDef_t FontNormal = {
-  7, 12, Font12_Table
-};
-FontDef_t FontTitle = {
-  14, 20, Font20_Table
-};
+void font_iterator_init(FontIterator_t* glyphs, const FontDef_t* font, const char* text, int16_t x, int16_t y) {
+  glyphs->font = font;
+  glyphs->text = text;
+  glyphs->line_x = x;
+  glyphs->pen_x = x;
+  glyphs->x = x;
+  glyphs->y = y;
+  glyphs->width = 0;
+  glyphs->missing = 0;
+}
+
+// count bits (<= 24) from bit offset of a MSB first stream, left aligned
+inline static uint32_t font_read_bits(const uint8_t* bits, uint32_t offset, uint8_t count) {
+  const uint8_t* word = &bits[offset >> 3];
+  const uint32_t value = ((uint32_t)word[0] << 24) | (word[1] << 16) | (word[2] << 8) | word[3];
+
+  return (value << (offset & 7)) & ~(UINT32_MAX >> count);
+}
+
+/* Step to the next glyph, decoding its columns when decode is set
+ *  Returns false at the end of the text, or at a character not in the font
+ *  (left in missing).
+ */
+bool font_iterator_next(FontIterator_t* glyphs, bool decode) {
+  const FontDef_t* font = glyphs->font;
+
+  for(;; glyphs->text++) {
+    const char ch = *glyphs->text;
+
+    if(ch == '\0')
+      return false;
+
+    if(ch == '\n') {
+      glyphs->y += font->font_height;
+      glyphs->pen_x = glyphs->line_x;
+      continue;
+    }
+    if(ch == '\t') {
+      glyphs->pen_x += font->font_width * 2;
+      continue;
+    }
+
+    const uint8_t index = ch < FONT_FIRST_CHAR || ch > FONT_LAST_CHAR
+      ? FONT_MISSING
+      : font->map[ch - FONT_FIRST_CHAR];
+    if(index == FONT_MISSING) {
+      glyphs->missing = ch;
+      return false;
+    }
+
+    const FontGlyph_t* glyph = &font->glyphs[index];
+    glyphs->x = glyphs->pen_x + glyph->offset;
+    glyphs->width = glyph->width;
+    glyphs->pen_x += glyph->advance;
+    glyphs->text++;
+
+    if(decode) {
+      const uint8_t column_bytes = (font->font_height + 7) / 8;
+      uint32_t offset = glyph->bits;
+      uint8_t* out = glyphs->columns;
+
+      for(uint8_t c = 0; c < glyph->width; c++, offset += font->font_height) {
+        const uint32_t column = font_read_bits(font->bits, offset, font->font_height);
+        for(uint8_t b = 0; b < column_bytes; b++) {
+          *out++ = column >> (24 - b * 8);
+        }
+      }
+    }
+
+    return true;
+  }
+}
+
+// Landscape width of the widest line of text
+uint16_t font_text_width(const FontDef_t* font, const char* text) {
+  FontIterator_t glyphs;
+  int16_t widest = 0;
+
+  font_iterator_init(&glyphs, font, text, 0, 0);
+  while(font_iterator_next(&glyphs, false)) {
+    if(glyphs.pen_x > widest)
+      widest = glyphs.pen_x;
+  }
+  if(glyphs.pen_x > widest)
+    widest = glyphs.pen_x;
+
+  return widest;
+}
@@ -1,10 +1,32 @@
+#pragma once
+
 #include <pico/stdlib.h>
 
+#define FONT_FIRST_CHAR         ' '
+#define FONT_LAST_CHAR          '~'
+#define FONT_MISSING            0xff    // map entry of a character left out of the subset
+
+#define FONT_MAX_COLUMNS        16
+#define FONT_MAX_COLUMN_BYTES   3
+
+typedef struct {
+  uint16_t bits;              // first bit of the glyph's columns
+  uint8_t offset;             // blank columns before the first stored one
+  uint8_t width;              // stored (inked) columns
+  uint8_t advance;
+} FontGlyph_t;
+
+/* Proportional font, generated by tools/native-bitmaps.py from font-tables.c
+ *  Only the characters the firmware draws are kept. Each glyph is stored as its
+ *  inked columns of font_height bits, packed back to back MSB first.
+ */
 typedef struct FontDef
 {
-  uint8_t font_width;
+  uint8_t font_width;         // advance of a space (and a digit), tabs are two
   uint8_t font_height;
-  const uint8_t *data;
+  const uint8_t* map;         // glyph of each character from FONT_FIRST_CHAR
+  const FontGlyph_t* glyphs;
+  const uint8_t* bits;
 } FontDef_t;
 
 typedef struct FontSize
@@ -13,5 +35,25 @@ typedef struct FontSize
   uint16_t height;
 } FontSize_t;
 
+/* Glyphs of a string, one at a time
+ *  font_iterator_next() steps over tabs and newlines, and decodes the next glyph
+ *  into columns (in canvas_blit() layout) to be drawn at x, y.
+ */
+typedef struct {
+  const FontDef_t* font;
+  const char* text;
+  int16_t line_x;             // landscape x lines start at
+  int16_t pen_x;              // where the next glyph advances from
+  int16_t x;
+  int16_t y;
+  uint8_t width;
+  char missing;               // the character iteration stopped at, 0 at the end of text
+  uint8_t columns[FONT_MAX_COLUMNS * FONT_MAX_COLUMN_BYTES];
+} FontIterator_t;
+
 extern FontDef_t FontNormal;
 extern FontDef_t FontTitle;
+
+void font_iterator_init(FontIterator_t* glyphs, const FontDef_t* font, const char* text, int16_t x, int16_t y);
+bool font_iterator_next(FontIterator_t* glyphs, bool decode);
+uint16_t font_text_width(const FontDef_t* font, const char* text);
@@ -0,0 +1,78 @@
+#include "display.h"
+
+/* Stand-in panel keeping the controller's RAM in memory
+ *  Lets the firmware (or a host build) run without a panel attached, and the
+ *  frames sent to be inspected through panel_host_state().
+ */
+
+static PanelHostState_t panel_host_ram;
+static const CanvasRect_t* panel_host_window;
+
+static void panel_host_init() {
+  panel_host_ram.standby = false;
+  panel_host_ram.sleeping = false;
+  panel_host_window = NULL;
+}
+
+static void panel_host_load_lut(PanelRefresh_t mode) {
+}
+
+static void panel_host_set_window(const CanvasRect_t* region) {
+  panel_host_window = region;
+}
+
+static void panel_host_write(uint8_t plane, const uint8_t* data, uint16_t stride, display_callback_t done) {
+  const CanvasRect_t screen = { 0, SCREEN_W - 1, 0, SCREEN_H - 1 };
+  const CanvasRect_t* window = panel_host_window ? panel_host_window : &screen;
+  const uint16_t line_bytes = window->byte_end - window->byte_start + 1;
+
+  for(uint16_t row = window->row_start; row <= window->row_end; row++, data += stride) {
+    memcpy(&panel_host_ram.ram[plane][row * SCREEN_W + window->byte_start], data + window->byte_start, line_bytes);
+  }
+  panel_host_ram.bytes_written += line_bytes * (window->row_end - window->row_start + 1);
+
+  if(done)
+    done();
+}
+
+static void panel_host_fill(uint8_t plane, uint8_t value) {
+  memset(panel_host_ram.ram[plane], value, SCREEN_W * SCREEN_H);
+}
+
+static void panel_host_refresh(PanelRefresh_t mode) {
+  panel_host_ram.refreshes[mode]++;
+}
+
+static void panel_host_power_off() {
+  panel_host_ram.standby = true;
+}
+
+static void panel_host_power_on() {
+  panel_host_ram.standby = false;
+}
+
+static void panel_host_sleep() {
+  panel_host_ram.sleeping = true;
+}
+
+const PanelHostState_t* panel_host_state() {
+  return &panel_host_ram;
+}
+
+const PanelDriver_t panel_host = {
+  .name = "Host stand-in",
+  .planes = 2,
+  .refresh_modes = (1 << PanelRefreshFull) | (1 << PanelRefreshPartial) | (1 << PanelRefreshFast),
+  .refresh_ms = { 0, 0, 0 },
+  .has_busy = false,
+  .init = panel_host_init,
+  .load_lut = panel_host_load_lut,
+  .set_window = panel_host_set_window,
+  .write = panel_host_write,
+  .fill = panel_host_fill,
+  .refresh = panel_host_refresh,
+  .status = NULL,
+  .power_off = panel_host_power_off,
+  .power_on = panel_host_power_on,
+  .sleep = panel_host_sleep,
+};
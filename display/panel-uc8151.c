@@ -0,0 +1,232 @@
+#include "display.h"
+
+/* UC8151 controller based panels, 128x296
+ *  panel_uc8151_bwr is the three colour panel (Waveshare epd2in13b_V3 command set)
+ *  refreshed with its OTP waveforms only. panel_uc8151_bw is a black and white
+ *  panel (e.g. Waveshare 2.9" (D)), which also takes a waveform uploaded to the
+ *  LUT registers for fast refreshes.
+ */
+
+#define UC8151_LUT_VCOM   0x20
+#define UC8151_LUT_WW     0x21
+#define UC8151_LUT_BW     0x22
+#define UC8151_LUT_WB     0x23
+#define UC8151_LUT_BB     0x24
+
+#define UC8151_LUT_SIZE       42
+#define UC8151_LUT_VCOM_SIZE  44
+
+/* Fast waveform, one phase of 0x19 + 0x01 frames at 100Hz (PLL 0x3a), ~0.26s
+ *  Each group is a level select byte (2 bits per frame group: 00 VCOM, 01 VDH,
+ *  10 VDL, 11 float), four frame counts and a repeat count. The new pixel value
+ *  alone picks the drive, so the old frame (DTM1) never needs sending.
+ */
+static const uint8_t uc8151_lut_fast_vcom[UC8151_LUT_VCOM_SIZE] = {
+  0x00, 0x19, 0x01, 0x00, 0x00, 0x01,
+};
+static const uint8_t uc8151_lut_fast_white[UC8151_LUT_SIZE] = {
+  0x80, 0x19, 0x01, 0x00, 0x00, 0x01,
+};
+static const uint8_t uc8151_lut_fast_black[UC8151_LUT_SIZE] = {
+  0x40, 0x19, 0x01, 0x00, 0x00, 0x01,
+};
+
+#define UC8151_RESOLUTION   EPD_TCON_RESOLUTION, 3, 0x80, 0x01, 0x28
+
+static const uint8_t uc8151_power_off_sequence[] = {
+  EPD_POWER_OFF, DISPLAY_SEQ_BUSY,
+};
+
+static const uint8_t uc8151_power_on_sequence[] = {
+  EPD_POWER_ON, DISPLAY_SEQ_BUSY,
+};
+
+static const uint8_t uc8151_sleep_sequence[] = {
+  EPD_POWER_OFF, DISPLAY_SEQ_BUSY,
+  EPD_DEEP_SLEEP, 1, EPD_CHECK_CODE,
+};
+
+static const CanvasRect_t* uc8151_window;
+static PanelRefresh_t uc8151_lut = PanelRefreshFull;
+
+static void uc8151_set_window(const CanvasRect_t* region) {
+  if(region == NULL) {
+    if(uc8151_window != NULL)
+      display_send_command(EPD_PARTIAL_OUT);
+    uc8151_window = NULL;
+    return;
+  }
+
+  if(uc8151_window == NULL)
+    display_send_command(EPD_PARTIAL_IN);
+  uc8151_window = region;
+
+  const uint8_t window[] = {
+    region->byte_start << 3,
+    (region->byte_end << 3) | 0x07, // byte boundary
+    region->row_start / 256,
+    region->row_start % 256,
+    region->row_end / 256,
+    region->row_end % 256,
+    0x01,
+  };
+  display_send_payload(EPD_PARTIAL_WINDOW, window, sizeof(window));
+}
+
+static void uc8151_refresh(PanelRefresh_t mode) {
+  display_send_command(EPD_DISPLAY_REFRESH);
+}
+
+static void uc8151_status() {
+  display_send_command(EPD_GET_STATUS);
+}
+
+// Drivers off, the registers (and RAM) are kept so POWER_ON is all a wake needs
+static void uc8151_power_off() {
+  display_send_sequence(uc8151_power_off_sequence, sizeof(uc8151_power_off_sequence));
+}
+
+static void uc8151_power_on() {
+  display_send_sequence(uc8151_power_on_sequence, sizeof(uc8151_power_on_sequence));
+}
+
+static void uc8151_sleep() {
+  display_send_sequence(uc8151_sleep_sequence, sizeof(uc8151_sleep_sequence));
+  uc8151_window = NULL;
+}
+
+// Three colour panel
+
+static const uint8_t uc8151_bwr_init_sequence[] = {
+  EPD_BOOSTER_SOFT_START, 3, 0x17, 0x17, 0x17,
+  EPD_POWER_ON, 0,
+  EPD_PANEL_SETTING, 2, 0x0f, 0x89,
+  //EPD_PLL_CONTROL, 1, 0x3c,
+  UC8151_RESOLUTION,
+  EPD_VCOM_AND_DATA_INTERVAL_SETTING, 1, 0x77,
+};
+
+static void uc8151_bwr_init() {
+  display_reset();
+  display_send_sequence(uc8151_bwr_init_sequence, sizeof(uc8151_bwr_init_sequence));
+}
+
+// Only the OTP waveforms
+static void uc8151_bwr_load_lut(PanelRefresh_t mode) {
+}
+
+static void uc8151_bwr_write(uint8_t plane, const uint8_t* data, uint16_t stride, display_callback_t done) {
+  display_send_rows(plane == 0 ? EPD_DATA_START_TRANSMISSION_1 : EPD_DATA_START_TRANSMISSION_2,
+      data, stride, uc8151_window, done);
+}
+
+static void uc8151_bwr_fill(uint8_t plane, uint8_t value) {
+  display_send_fill(plane == 0 ? EPD_DATA_START_TRANSMISSION_1 : EPD_DATA_START_TRANSMISSION_2, value);
+}
+
+const PanelDriver_t panel_uc8151_bwr = {
+  .name = "UC8151 black, white and red",
+  .planes = 2,
+  .refresh_modes = (1 << PanelRefreshFull) | (1 << PanelRefreshPartial),
+  .refresh_ms = { 15000, 15000, 0 },
+  .has_busy = true,
+  .init = uc8151_bwr_init,
+  .load_lut = uc8151_bwr_load_lut,
+  .set_window = uc8151_set_window,
+  .write = uc8151_bwr_write,
+  .fill = uc8151_bwr_fill,
+  .refresh = uc8151_refresh,
+  .status = uc8151_status,
+  .power_off = uc8151_power_off,
+  .power_on = uc8151_power_on,
+  .sleep = uc8151_sleep,
+};
+
+// Black and white panel
+
+static const uint8_t uc8151_bw_init_sequence[] = {
+  EPD_POWER_SETTING, 5, 0x03, 0x00, 0x2b, 0x2b, 0x03,
+  EPD_BOOSTER_SOFT_START, 3, 0x17, 0x17, 0x17,
+  EPD_POWER_ON, DISPLAY_SEQ_BUSY,
+  UC8151_RESOLUTION,
+  EPD_VCM_DC_SETTING_REGISTER, 1, 0x12,
+};
+
+// waveform from the LUT registers (uploaded after), black and white, 128x296
+static const uint8_t uc8151_bw_fast_sequence[] = {
+  EPD_PANEL_SETTING, 1, 0xbf,
+  EPD_PLL_CONTROL, 1, 0x3a,
+  EPD_VCOM_AND_DATA_INTERVAL_SETTING, 1, 0x47,
+};
+
+// OTP waveform, black and white, 128x296
+static const uint8_t uc8151_bw_full_sequence[] = {
+  EPD_PANEL_SETTING, 1, 0x1f,
+  EPD_VCOM_AND_DATA_INTERVAL_SETTING, 1, 0x97,
+};
+
+static void uc8151_bw_load_lut(PanelRefresh_t mode) {
+  if(mode == PanelRefreshFast) {
+    display_send_sequence(uc8151_bw_fast_sequence, sizeof(uc8151_bw_fast_sequence));
+    display_send_payload(UC8151_LUT_VCOM, uc8151_lut_fast_vcom, UC8151_LUT_VCOM_SIZE);
+    display_send_payload(UC8151_LUT_WW, uc8151_lut_fast_white, UC8151_LUT_SIZE);
+    display_send_payload(UC8151_LUT_BW, uc8151_lut_fast_white, UC8151_LUT_SIZE);
+    display_send_payload(UC8151_LUT_WB, uc8151_lut_fast_black, UC8151_LUT_SIZE);
+    display_send_payload(UC8151_LUT_BB, uc8151_lut_fast_black, UC8151_LUT_SIZE);
+  } else {
+    display_send_sequence(uc8151_bw_full_sequence, sizeof(uc8151_bw_full_sequence));
+  }
+
+  uc8151_lut = mode;
+}
+
+static void uc8151_bw_init() {
+  display_reset();
+  display_send_sequence(uc8151_bw_init_sequence, sizeof(uc8151_bw_init_sequence));
+}
+
+// New data goes to DTM2, the OTP waveform also wants the old frame (DTM1) cleared
+static void uc8151_bw_write(uint8_t plane, const uint8_t* data, uint16_t stride, display_callback_t done) {
+  if(plane != 0) {
+    if(done)
+      done();
+    return;
+  }
+
+  if(uc8151_lut == PanelRefreshFull && uc8151_window == NULL)
+    display_send_fill(EPD_DATA_START_TRANSMISSION_1, 0x00);
+
+  display_send_rows(EPD_DATA_START_TRANSMISSION_2, data, stride, uc8151_window, done);
+}
+
+static void uc8151_bw_fill(uint8_t plane, uint8_t value) {
+  if(plane == 0)
+    display_send_fill(EPD_DATA_START_TRANSMISSION_2, value);
+}
+
+static void uc8151_bw_refresh(PanelRefresh_t mode) {
+  const PanelRefresh_t lut = mode == PanelRefreshFast ? PanelRefreshFast : PanelRefreshFull;
+
+  if(lut != uc8151_lut)
+    uc8151_bw_load_lut(lut);
+
+  display_send_command(EPD_DISPLAY_REFRESH);
+}
+
+const PanelDriver_t panel_uc8151_bw = {
+  .name = "UC8151 black and white",
+  .planes = 1,
+  .refresh_modes = (1 << PanelRefreshFull) | (1 << PanelRefreshPartial) | (1 << PanelRefreshFast),
+  .refresh_ms = { 2000, 2000, 260 },
+  .has_busy = true,
+  .init = uc8151_bw_init,
+  .load_lut = uc8151_bw_load_lut,
+  .set_window = uc8151_set_window,
+  .write = uc8151_bw_write,
+  .fill = uc8151_bw_fill,
+  .refresh = uc8151_bw_refresh,
+  .status = uc8151_status,
+  .power_off = uc8151_power_off,
+  .power_on = uc8151_power_on,
+  .sleep = uc8151_sleep,
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <pico/stdlib.h>
+
+#include "canvas.h"
+
+typedef void (*display_callback_t)();
+
+typedef enum {
+  PanelRefreshFull,       // the panel's own (OTP) waveform, clears ghosting
+  PanelRefreshPartial,    // the full waveform, limited to the window
+  PanelRefreshFast,       // short waveform uploaded to the controller, black and white only
+  PanelRefreshCount,
+} PanelRefresh_t;
+
+#define PANEL_SUPPORTS(panel, mode) (((panel)->refresh_modes >> (mode)) & 1)
+
+/* Operations of an e-ink panel (and its controller)
+ *  Planes are the canvas' SCREEN_H rows of SCREEN_W bytes, 0 black and 1 red, panels
+ *  with a single plane ignore writes to the red one. write() streams data into the
+ *  window of the last set_window() (NULL is the whole screen), where data holds
+ *  rows of stride bytes starting at the window's first row, and calls done once
+ *  the transfer completes. refresh() only starts the refresh, display.c waits for
+ *  BUSY when the panel has one.
+ */
+typedef struct {
+  const char* name;
+  uint8_t planes;
+  uint8_t refresh_modes;              // bit per PanelRefresh_t
+  uint16_t refresh_ms[PanelRefreshCount];   // typical, 0 when unsupported
+  bool has_busy;
+
+  void (*init)();
+  void (*load_lut)(PanelRefresh_t mode);
+  void (*set_window)(const CanvasRect_t* region);
+  void (*write)(uint8_t plane, const uint8_t* data, uint16_t stride, display_callback_t done);
+  void (*fill)(uint8_t plane, uint8_t value);
+  void (*refresh)(PanelRefresh_t mode);
+  void (*status)();                   // nudge the controller to drive BUSY, may be NULL
+  void (*power_off)();                // standby, keeps the registers, may be NULL
+  void (*power_on)();                 // back from power_off()
+  void (*sleep)();                    // deep sleep, only a reset (and init()) wakes it
+} PanelDriver_t;
+
+extern const PanelDriver_t panel_uc8151_bwr;
+extern const PanelDriver_t panel_uc8151_bw;
+extern const PanelDriver_t panel_host;
+
+// Stand-in panel state, for running without a panel attached
+typedef struct {
+  uint8_t ram[2][SCREEN_W * SCREEN_H];
+  uint32_t refreshes[PanelRefreshCount];
+  uint32_t bytes_written;
+  bool standby;
+  bool sleeping;
+} PanelHostState_t;
+
+const PanelHostState_t* panel_host_state();
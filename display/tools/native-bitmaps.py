@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""Convert the font tables and XBM menu icons into the panel's native layout.
+
+The display is drawn rotated by 270 degrees, so each column of a glyph on
+screen is a run of bits along one native row of the panel. Icons are stored
+column by column, each column packed MSB first into ceil(h / 8) bytes, ready
+for canvas_blit() to shift into place.
+
+Fonts are subset to the characters the text sources can draw (their string
+and character literals outside printf calls, and the digits), trimmed to each
+glyph's inked columns for proportional advances, and stored as a single
+stream of h bit columns without padding, for font_iterator_next() to decode.
+Digits keep a common (tabular) advance, as does the space, so numbers padded
+with spaces still line up.
+
+usage: native-bitmaps.py <font-tables.c> <menu-images.h> <out.c> <out.h> [text sources...]
+"""
+import codecs
+import re
+import sys
+
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7e
+
+FONTS = [
+    # table, width, height, font symbol
+    ("Font12_Table", 7, 12, "FontNormal"),
+    ("Font20_Table", 14, 20, "FontTitle"),
+]
+
+DIGITS = "0123456789"
+GLYPH_SPACING = 1       # blank columns after each glyph
+MAX_COLUMNS = 16        # FONT_MAX_COLUMNS
+
+
+def strip_comments(source):
+    source = re.sub(r"/\*.*?\*/", "", source, flags=re.S)
+    return re.sub(r"//[^\n]*", "", source)
+
+
+def parse_array(source, name):
+    match = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\};" % re.escape(name), source, re.S)
+    if not match:
+        sys.exit("native-bitmaps: unable to find array %s" % name)
+    return [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{2}", match.group(1))]
+
+
+def pack_column(bits):
+    """Pack a list of 0/1 (top to bottom on screen) MSB first."""
+    out = []
+    for i in range(0, len(bits), 8):
+        byte = 0
+        for j, bit in enumerate(bits[i:i + 8]):
+            byte |= bit << (7 - j)
+        out.append(byte)
+    return out
+
+
+def rotate(width, height, pixel):
+    data = []
+    for x in range(width):
+        data += pack_column([pixel(x, y) for y in range(height)])
+    return data
+
+
+def text_characters(paths):
+    """Characters the sources can draw, None (everything) without sources."""
+    if not paths:
+        return None
+
+    chars = set(" " + DIGITS)
+    for path in paths:
+        source = strip_comments(open(path).read())
+        source = re.sub(r"#\s*include[^\n]*", "", source)
+        source = re.sub(r"\bprintf\s*\((?:\"(?:\\.|[^\"\\])*\"|[^;])*;", "", source)
+        for literal in re.findall(r'"((?:\\.|[^"\\])*)"', source) + re.findall(r"'(\\.|[^'\\])'", source):
+            chars.update(codecs.decode(literal, "unicode_escape"))
+
+    return set(c for c in chars if FIRST_CHAR <= ord(c) <= LAST_CHAR)
+
+
+def font_columns(table, width, height):
+    """Columns (lists of bits, top to bottom) of every glyph in the table."""
+    row_bytes = (width + 7) // 8
+    glyph_bytes = row_bytes * height
+    glyphs = LAST_CHAR - FIRST_CHAR + 1
+    if len(table) != glyphs * glyph_bytes:
+        sys.exit("native-bitmaps: font table has %d bytes, expected %d" % (len(table), glyphs * glyph_bytes))
+
+    fonts = []
+    for g in range(glyphs):
+        glyph = table[g * glyph_bytes:(g + 1) * glyph_bytes]
+        fonts.append([[(glyph[y * row_bytes + x // 8] >> (7 - x % 8)) & 1 for y in range(height)]
+                      for x in range(width)])
+    return fonts
+
+
+def pack_font(table, width, height, chars):
+    """Glyph map, glyph metrics and the packed column stream of a font subset."""
+    columns = font_columns(table, width, height)
+
+    def inked(ch):
+        cols = columns[ord(ch) - FIRST_CHAR]
+        ink = [x for x, col in enumerate(cols) if any(col)]
+        return (ink[0], ink[-1] + 1) if ink else (0, 0)
+
+    digit_advance = max(inked(d)[1] - inked(d)[0] for d in DIGITS) + GLYPH_SPACING
+
+    glyph_map = []
+    glyphs = []
+    bits = []
+    for code in range(FIRST_CHAR, LAST_CHAR + 1):
+        ch = chr(code)
+        if chars is not None and ch not in chars:
+            glyph_map.append(0xff)
+            continue
+
+        first, last = inked(ch)
+        advance = last - first + GLYPH_SPACING
+        offset = 0
+        if ch in DIGITS or ch == " ":
+            offset = (digit_advance - advance) // 2
+            advance = digit_advance
+        if last - first > MAX_COLUMNS:
+            sys.exit("native-bitmaps: glyph %r is wider than %d columns" % (ch, MAX_COLUMNS))
+        if len(bits) >= 0x10000:
+            sys.exit("native-bitmaps: font is too large for 16 bit offsets")
+
+        glyph_map.append(len(glyphs))
+        glyphs.append((len(bits), offset, last - first, advance))
+        for col in columns[code - FIRST_CHAR][first:last]:
+            bits += col
+
+    # padded so the decoder can always read a whole 32 bit word
+    data = pack_column(bits) + [0, 0, 0, 0]
+    return glyph_map, glyphs, data, digit_advance
+
+
+def rotate_xbm(bitmap, width, height):
+    row_bytes = (width + 7) // 8
+    return rotate(width, height,
+                  lambda x, y: (bitmap[y * row_bytes + x // 8] >> (x % 8)) & 1)
+
+
+def format_bytes(data, indent="  ", per_line=12):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02x" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) < 5:
+        sys.exit(__doc__)
+    font_path, images_path, out_c, out_h = sys.argv[1:5]
+    chars = text_characters(sys.argv[5:])
+
+    fonts = strip_comments(open(font_path).read())
+    images = open(images_path).read()
+
+    size = re.search(r"#define\s+MENU_IMAGE_SIZE\s+(\d+)", images)
+    icon_size = int(size.group(1))
+    icon_names = re.findall(r"\b(\w+)_bits\[\]", images)
+    images = strip_comments(images)
+
+    header = [
+        "// Generated by display/tools/native-bitmaps.py, do not edit",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        "typedef struct {",
+        "  uint8_t width;",
+        "  uint8_t height;",
+        "  const uint8_t* data;",
+        "} NativeBitmap_t;",
+        "",
+    ]
+    source = [
+        "// Generated by display/tools/native-bitmaps.py, do not edit",
+        '#include "native-bitmaps.h"',
+        '#include "font.h"',
+        "",
+    ]
+
+    for table, width, height, symbol in FONTS:
+        if height > 24:
+            sys.exit("native-bitmaps: %s is too tall to blit" % table)
+        glyph_map, glyphs, data, space = pack_font(parse_array(fonts, table), width, height, chars)
+        source += [
+            "static const uint8_t %s_map[] = {" % symbol, format_bytes(glyph_map), "};",
+            "static const FontGlyph_t %s_glyphs[] = {" % symbol,
+            "\n".join("  { %d, %d, %d, %d }, // %s" % (g + (repr(chr(c)),))
+                      for g, c in zip(glyphs, [FIRST_CHAR + i for i, m in enumerate(glyph_map) if m != 0xff])),
+            "};",
+            "static const uint8_t %s_bits[] = {" % symbol, format_bytes(data), "};",
+            "FontDef_t %s = { %d, %d, %s_map, %s_glyphs, %s_bits };" % (symbol, space, height, symbol, symbol, symbol),
+            "",
+        ]
+        print("native-bitmaps: %s %d glyphs, %d bytes (was %d)" % (
+            symbol, len(glyphs), len(glyph_map) + len(glyphs) * 6 + len(data),
+            len(parse_array(fonts, table))))
+
+    for name in icon_names:
+        data = rotate_xbm(parse_array(images, name + "_bits"), icon_size, icon_size)
+        header.append("extern const NativeBitmap_t %s_native;" % name)
+        source += [
+            "static const uint8_t %s_data[] = {" % name, format_bytes(data), "};",
+            "const NativeBitmap_t %s_native = { %d, %d, %s_data };" % (name, icon_size, icon_size, name),
+            "",
+        ]
+
+    with open(out_h, "w") as f:
+        f.write("\n".join(header) + "\n")
+    with open(out_c, "w") as f:
+        f.write("\n".join(source))
+
+
+if __name__ == "__main__":
+    main()
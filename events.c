@@ -0,0 +1,34 @@
+#include "events.h"
+
+static queue_t events;
+static volatile uint32_t dropped;
+
+void events_init() {
+  queue_init(&events, sizeof(Event_t), EVENTS_QUEUE_SIZE);
+}
+
+// Safe to call from interrupt context, or core 1
+bool events_post(EventType_t type) {
+  const Event_t event = { type, time_us_64() };
+
+  if(!queue_try_add(&events, &event)) {
+    dropped++;
+    return false;
+  }
+
+  // wake the main loop if it is waiting for work
+  __sev();
+  return true;
+}
+
+bool events_pop(Event_t* event) {
+  return queue_try_remove(&events, event);
+}
+
+bool events_pending() {
+  return !queue_is_empty(&events);
+}
+
+uint32_t events_dropped() {
+  return dropped;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <pico/stdlib.h>
+#include <pico/util/queue.h>
+#include <hardware/sync.h>
+
+#define EVENTS_QUEUE_SIZE   16
+
+typedef enum {
+  EventButton,            // debounced press of BTN_PIN
+  EventData,              // a new snapshot was published
+  EventSample,            // core 1 queued an acquisition round
+} EventType_t;
+
+typedef struct {
+  EventType_t type;
+  uint64_t posted_at;
+} Event_t;
+
+/* Events waking the main loop
+ *  Posted from interrupts, either core, or the main loop itself. Posting wakes a
+ *  main loop waiting in scheduler_wait(), the loop then drains the queue and acts
+ *  on all of the events together, so a burst of presses renders once.
+ */
+void events_init();
+bool events_post(EventType_t type);
+bool events_pop(Event_t* event);
+bool events_pending();
+uint32_t events_dropped();
@@ -0,0 +1,124 @@
+#include <string.h>
+#include "format.h"
+
+static const char* format_units[UnitCount] = {
+  [UnitNone] = "",
+  [UnitWatts] = "W",
+  [UnitVolts] = "V",
+  [UnitAmps] = "A",
+  [UnitAmpHours] = "Ah",
+  [UnitPercent] = "%",
+  [UnitHours] = "h",
+  [UnitDays] = "d",
+};
+
+static const uint32_t format_powers[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+inline static void format_char(Format_t* format, char c) {
+  if(format->length + 1 >= format->size) {
+    format->truncated = true;
+    return;
+  }
+
+  format->buffer[format->length++] = c;
+  format->buffer[format->length] = '\0';
+}
+
+// Digits of value, at least min_digits of them (zero padded)
+static void format_digits(Format_t* format, uint32_t value, uint8_t min_digits) {
+  char digits[10];
+  uint8_t count = 0;
+
+  do {
+    digits[count++] = '0' + value % 10;
+    value /= 10;
+  } while(value > 0 || count < min_digits);
+
+  while(count > 0) {
+    format_char(format, digits[--count]);
+  }
+}
+
+void format_init(Format_t* format, char* buffer, uint8_t size) {
+  format->buffer = buffer;
+  format->size = size;
+  format->length = 0;
+  format->truncated = false;
+
+  if(size > 0)
+    buffer[0] = '\0';
+  else
+    format->truncated = true;
+}
+
+void format_text(Format_t* format, const char* text) {
+  while(*text) {
+    format_char(format, *text++);
+  }
+}
+
+void format_unit(Format_t* format, FormatUnit_t unit) {
+  if(unit < UnitCount)
+    format_text(format, format_units[unit]);
+}
+
+void format_int(Format_t* format, int32_t value, FormatUnit_t unit) {
+  if(value < 0)
+    format_char(format, '-');
+
+  format_digits(format, value < 0 ? -(uint32_t)value : (uint32_t)value, 1);
+  format_unit(format, unit);
+}
+
+/* Fixed point value, in units of 10^-decimals, shown with places decimal places
+ *  e.g. 1234 with 2 decimals is 12.34, shown as "12.3" with 1 place (rounded half
+ *  away from zero) or "12.340" with 3.
+ */
+void format_fixed(Format_t* format, int32_t value, uint8_t decimals, uint8_t places, FormatUnit_t unit) {
+  uint32_t magnitude = value < 0 ? -(uint32_t)value : (uint32_t)value;
+
+  if(decimals > 9)
+    decimals = 9;
+  if(places > 9)
+    places = 9;
+
+  if(places < decimals) {
+    const uint32_t divisor = format_powers[decimals - places];
+    magnitude = (magnitude + divisor / 2) / divisor;
+  } else {
+    magnitude *= format_powers[places - decimals];
+  }
+
+  if(value < 0 && magnitude > 0)
+    format_char(format, '-');
+
+  format_digits(format, magnitude / format_powers[places], 1);
+  if(places > 0) {
+    format_char(format, '.');
+    format_digits(format, magnitude % format_powers[places], places);
+  }
+  format_unit(format, unit);
+}
+
+// An explicit '+' for positive values, negatives carry their own sign
+void format_sign(Format_t* format, int32_t value) {
+  if(value > 0)
+    format_char(format, '+');
+}
+
+// Pad the text so far with leading spaces to width characters
+void format_align_right(Format_t* format, uint8_t width) {
+  if(format->size == 0)
+    return;
+  if(width >= format->size)
+    width = format->size - 1;
+  if(format->length >= width)
+    return;
+
+  const uint8_t pad = width - format->length;
+  memmove(&format->buffer[pad], format->buffer, format->length + 1);
+  memset(format->buffer, ' ', pad);
+  format->length = width;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+  UnitNone,
+  UnitWatts,
+  UnitVolts,
+  UnitAmps,
+  UnitAmpHours,
+  UnitPercent,
+  UnitHours,
+  UnitDays,
+  UnitCount,
+} FormatUnit_t;
+
+/* Text built into a caller's buffer, without printf
+ *  Every append is bounds checked, the text is cut short (and truncated set)
+ *  rather than overrunning the buffer, and it is always terminated.
+ */
+typedef struct {
+  char* buffer;
+  uint8_t size;
+  uint8_t length;
+  bool truncated;
+} Format_t;
+
+void format_init(Format_t* format, char* buffer, uint8_t size);
+void format_text(Format_t* format, const char* text);
+void format_unit(Format_t* format, FormatUnit_t unit);
+void format_int(Format_t* format, int32_t value, FormatUnit_t unit);
+void format_fixed(Format_t* format, int32_t value, uint8_t decimals, uint8_t places, FormatUnit_t unit);
+void format_sign(Format_t* format, int32_t value);
+void format_align_right(Format_t* format, uint8_t width);
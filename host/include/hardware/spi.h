@@ -0,0 +1,16 @@
+#pragma once
+
+#include <pico/stdlib.h>
+
+#define SPI_SSPICR_RORIC_BITS   0x1u
+
+typedef struct {
+  volatile uint32_t cr0, cr1, dr, sr, cpsr, imsc, ris, mis, icr, dmacr;
+} spi_hw_t;
+
+uint spi_init(spi_inst_t* spi, uint baudrate);
+int spi_write_blocking(spi_inst_t* spi, const uint8_t* src, size_t len);
+bool spi_is_busy(const spi_inst_t* spi);
+bool spi_is_readable(const spi_inst_t* spi);
+spi_hw_t* spi_get_hw(spi_inst_t* spi);
+uint spi_get_dreq(spi_inst_t* spi, bool is_tx);
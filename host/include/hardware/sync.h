@@ -0,0 +1,10 @@
+#pragma once
+
+#include <pico/stdlib.h>
+
+static inline uint32_t save_and_disable_interrupts(void) {
+  return 0;
+}
+
+static inline void restore_interrupts(uint32_t status) {
+}
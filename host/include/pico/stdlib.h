@@ -0,0 +1,58 @@
+#pragma once
+
+/* Host stand-ins for the parts of the pico-sdk the display and pages use
+ *  Just enough to build and run them natively, see host/pico-host.c. There is
+ *  no hardware: waits do nothing, DMA transfers complete at once, and the SPI
+ *  bytes only reach the callback of pico_host_spi_capture().
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+typedef unsigned int uint;
+
+typedef struct spi_inst spi_inst_t;
+#define spi0 ((spi_inst_t*)0)
+#define spi1 ((spi_inst_t*)1)
+
+#define GPIO_IN               0
+#define GPIO_OUT              1
+#define GPIO_IRQ_LEVEL_LOW    0x1u
+#define GPIO_IRQ_LEVEL_HIGH   0x2u
+#define GPIO_IRQ_EDGE_FALL    0x4u
+#define GPIO_IRQ_EDGE_RISE    0x8u
+
+enum gpio_function {
+  GPIO_FUNC_SPI = 1,
+  GPIO_FUNC_UART = 2,
+  GPIO_FUNC_SIO = 5,
+};
+
+typedef void (*irq_handler_t)(void);
+
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void* user_data);
+
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+void busy_wait_ms(uint32_t ms);
+void busy_wait_us_32(uint32_t us);
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void* user_data, bool fire_if_past);
+bool cancel_alarm(alarm_id_t id);
+
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_set_function(uint gpio, enum gpio_function function);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
+void gpio_set_irq_enabled(uint gpio, uint32_t events, bool enabled);
+void gpio_add_raw_irq_handler(uint gpio, irq_handler_t handler);
+void gpio_acknowledge_irq(uint gpio, uint32_t events);
+uint32_t gpio_get_irq_event_mask(uint gpio);
+
+static inline void tight_loop_contents(void) {}
+static inline void __wfe(void) {}
+static inline void __sev(void) {}
+static inline void __dmb(void) {}
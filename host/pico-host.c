@@ -0,0 +1,195 @@
+#include <time.h>
+
+#include <pico/stdlib.h>
+#include <hardware/sync.h>
+#include <hardware/irq.h>
+#include <hardware/clocks.h>
+#include <hardware/spi.h>
+#include <hardware/dma.h>
+
+#include "pico-host.h"
+
+/* Host definitions of the pico-sdk stand-ins in host/include
+ *  Time comes from the monotonic clock, waits return at once (so benchmarks
+ *  only measure the CPU work), and a triggered DMA transfer raises its
+ *  completion IRQ straight away. Bytes written to SPI, by the CPU or by DMA
+ *  into its data register, go to the pico_host_spi_capture() callback along
+ *  with the level last put on the DC pin.
+ */
+
+#define PICO_HOST_DMA_READ_INCREMENT  0x1u
+
+static irq_handler_t pico_host_dma_handler;
+static bool pico_host_dma_enabled;
+static bool pico_host_dma_pending;
+static spi_hw_t pico_host_spi_hw;
+
+static pico_host_spi_callback_t pico_host_spi_callback;
+static uint pico_host_dc_pin;
+static bool pico_host_dc;
+
+void pico_host_spi_capture(uint dc_pin, pico_host_spi_callback_t callback) {
+  pico_host_dc_pin = dc_pin;
+  pico_host_spi_callback = callback;
+}
+
+uint64_t time_us_64(void) {
+  static uint64_t boot_ns;
+  struct timespec now;
+  uint64_t now_ns;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  now_ns = (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+  if(boot_ns == 0)
+    boot_ns = now_ns;
+
+  return (now_ns - boot_ns) / 1000;
+}
+
+uint32_t time_us_32(void) {
+  return (uint32_t)time_us_64();
+}
+
+void busy_wait_ms(uint32_t ms) {
+}
+
+void busy_wait_us_32(uint32_t us) {
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void* user_data, bool fire_if_past) {
+  return 1;
+}
+
+bool cancel_alarm(alarm_id_t id) {
+  return true;
+}
+
+void gpio_init(uint gpio) {
+}
+
+void gpio_set_dir(uint gpio, bool out) {
+}
+
+void gpio_set_function(uint gpio, enum gpio_function function) {
+}
+
+void gpio_put(uint gpio, bool value) {
+  if(gpio == pico_host_dc_pin)
+    pico_host_dc = value;
+}
+
+// Inputs read high, so the panel's (active low) BUSY is always idle
+bool gpio_get(uint gpio) {
+  return true;
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t events, bool enabled) {
+}
+
+void gpio_add_raw_irq_handler(uint gpio, irq_handler_t handler) {
+}
+
+void gpio_acknowledge_irq(uint gpio, uint32_t events) {
+}
+
+uint32_t gpio_get_irq_event_mask(uint gpio) {
+  return 0;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {
+  if(num == DMA_IRQ_0)
+    pico_host_dma_handler = handler;
+}
+
+void irq_set_enabled(uint num, bool enabled) {
+}
+
+uint32_t clock_get_hz(enum clock_index clock) {
+  return 125000000;
+}
+
+uint spi_init(spi_inst_t* spi, uint baudrate) {
+  return baudrate;
+}
+
+int spi_write_blocking(spi_inst_t* spi, const uint8_t* src, size_t len) {
+  if(pico_host_spi_callback) {
+    for(size_t i = 0; i < len; i++) {
+      pico_host_spi_callback(src[i], pico_host_dc);
+    }
+  }
+  return len;
+}
+
+bool spi_is_busy(const spi_inst_t* spi) {
+  return false;
+}
+
+bool spi_is_readable(const spi_inst_t* spi) {
+  return false;
+}
+
+spi_hw_t* spi_get_hw(spi_inst_t* spi) {
+  return &pico_host_spi_hw;
+}
+
+uint spi_get_dreq(spi_inst_t* spi, bool is_tx) {
+  return 0;
+}
+
+int dma_claim_unused_channel(bool required) {
+  return 0;
+}
+
+// Reads increment by default, as on the device
+dma_channel_config dma_channel_get_default_config(uint channel) {
+  return (dma_channel_config){ PICO_HOST_DMA_READ_INCREMENT };
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config* config, enum dma_channel_transfer_size size) {
+}
+
+void channel_config_set_read_increment(dma_channel_config* config, bool increment) {
+  if(increment)
+    config->ctrl |= PICO_HOST_DMA_READ_INCREMENT;
+  else
+    config->ctrl &= ~PICO_HOST_DMA_READ_INCREMENT;
+}
+
+void channel_config_set_write_increment(dma_channel_config* config, bool increment) {
+}
+
+void channel_config_set_dreq(dma_channel_config* config, uint dreq) {
+}
+
+// The transfer is over as soon as it starts, bytes into the SPI data register are clocked out
+void dma_channel_configure(uint channel, const dma_channel_config* config, volatile void* write_addr,
+    const volatile void* read_addr, uint transfer_count, bool trigger) {
+  const volatile uint8_t* source = read_addr;
+  const bool increment = config->ctrl & PICO_HOST_DMA_READ_INCREMENT;
+
+  if(!trigger)
+    return;
+
+  if(write_addr == &pico_host_spi_hw.dr && pico_host_spi_callback) {
+    for(uint i = 0; i < transfer_count; i++) {
+      pico_host_spi_callback(source[increment ? i : 0], pico_host_dc);
+    }
+  }
+
+  pico_host_dma_pending = true;
+  if(pico_host_dma_enabled && pico_host_dma_handler)
+    pico_host_dma_handler();
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) {
+  pico_host_dma_enabled = enabled;
+}
+
+bool dma_channel_get_irq0_status(uint channel) {
+  return pico_host_dma_pending;
+}
+
+void dma_channel_acknowledge_irq0(uint channel) {
+  pico_host_dma_pending = false;
+}
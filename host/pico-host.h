@@ -0,0 +1,10 @@
+#pragma once
+
+#include <pico/stdlib.h>
+
+/* Host only hooks into the pico-sdk stand-ins of pico-host.c */
+
+// A byte clocked out over SPI, data when the DC pin was high (a command when low)
+typedef void (*pico_host_spi_callback_t)(uint8_t byte, bool data);
+
+void pico_host_spi_capture(uint dc_pin, pico_host_spi_callback_t callback);
@@ -0,0 +1,421 @@
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "pages.h"
+#include "uc8151-capture.h"
+
+/* Renders every page on the host through the panel_uc8151_bwr driver
+ *  The pages are drawn from fixed register fixtures and a synthetic history, and
+ *  sent as on the device. The planes the panel received (EPD_DATA_START_TRANSMISSION_1
+ *  and 2, decoded from the SPI bytes by uc8151-capture.c) are written out as black
+ *  and red PBM images, or compared with ones written before, such as host/golden.
+ *  The same pages (and the drawing primitives) are timed for benchmarks.
+ */
+
+#define RENDER_IMAGE_STRIDE   ((DISPLAY_H + 7) / 8)
+#define RENDER_IMAGE_SIZE     (RENDER_IMAGE_STRIDE * DISPLAY_W)
+#define RENDER_PATH_MAX       512
+#define RENDER_HISTORY_HOURS  48
+#define RENDER_IMAGES         (PageContentsCount + 1)   // the pages, then the narrow chart
+
+typedef struct {
+  const char* name;
+  void (*draw)();
+  uint32_t pixels;              // touched per call, 0 when not an area
+} RenderPrimitive_t;
+
+static const char* render_image_names[RENDER_IMAGES] = {
+  [Overview] = "overview",
+  [Solar] = "solar",
+  [Alternator] = "alternator",
+  [Statistics] = "statistics",
+  [PageContentsCount] = "chart-narrow",
+};
+
+// The single hour alternator spikes of the history, against SoC
+static const ChartSeries_t render_narrow_series[] = {
+  { StatAlternator, Red, ChartLine, ChartAxisRight },
+  { StatSoc, Black, ChartLine, ChartAxisLeft },
+};
+
+static const char* render_plane_names[2] = { "black", "red" };
+
+static Snapshot_t render_view;
+static StatsHistory_t render_history;
+static StatsQuery_t render_query;
+static uint8_t render_black[CANVAS_SIZE];
+static uint8_t render_red[CANVAS_SIZE];
+static Canvas_t render_canvas;
+static DisplayList_t render_list;
+static bool render_stand_in;    // panel_host in place of the decoded UC8151 stream
+
+// A battery at 78 % discharging at night levels, while solar and the alternator charge
+static void render_fixture_init(Snapshot_t* view) {
+  memset(view, 0, sizeof(*view));
+
+  view->lfp100s[LFP100S_REG_LOAD_A] = 65085;          // -4.5A
+  view->lfp100s[LFP100S_REG_VOLTAGE] = 133;           // 13.3V
+  view->lfp100s[LFP100S_REG_CAPACITY_1] = 1;          // 78Ah, in 2mAh over both registers
+  view->lfp100s[LFP100S_REG_CAPACITY_2] = 12464;
+  view->lfp100s[LFP100S_REG_MAX_CAPACITY_1] = 1;      // 100Ah
+  view->lfp100s[LFP100S_REG_MAX_CAPACITY_2] = 34464;
+
+  view->rvr40[RVR40_REG_SOLAR_V] = 182;
+  view->rvr40[RVR40_REG_SOLAR_A] = 1234;
+  view->rvr40[RVR40_REG_SOLAR_W] = 224;
+  view->rvr40[RVR40_REG_DAY_CHG_AMPHRS] = 42;
+  view->rvr40[RVR40_REG_DAY_DCHG_AMPHRS] = 17;
+  view->rvr40[RVR40_REG_TEMPERATURE] = (21 << 8) | 19;
+
+  view->dcc50s[DCC50S_REG_ALT_V] = 14;
+  view->dcc50s[DCC50S_REG_ALT_A] = 20;
+  view->dcc50s[DCC50S_REG_ALT_W] = 280;
+  view->dcc50s[DCC50S_REG_DAY_TOTAL_AH] = 35;
+  view->dcc50s[DCC50S_REG_TEMPERATURE] = (30 << 8) | 19;
+
+  view->rolling = (Statshot_t){
+    .bat_soc = 78.f,
+    .bat_v = 13.3f,
+    .load_w = -59.85f,
+    .sol_w = 224,
+    .alt_w = 280,
+    .charged_ah = 77,
+    .discharged_ah = 17,
+  };
+}
+
+// Two days of hourly statistics, solar by day, a drive morning and evening
+static void render_history_init(StatsHistory_t* history, StatsQuery_t* query) {
+  float soc = 70.f;
+
+  stats_history_init(history);
+  stats_query_init(query, history);
+
+  for(uint16_t h = 0; h < RENDER_HISTORY_HOURS; h++) {
+    const int16_t hour = h % 24;
+    const uint16_t sol_w = hour >= 7 && hour < 19 ? 240 - 40 * abs(hour - 13) : 0;
+    const uint16_t alt_w = hour == 8 || hour == 17 ? 300 : 0;
+    const float load_w = hour >= 7 && hour < 22 ? -25.f : -60.f;
+
+    soc += (sol_w + alt_w + load_w) / 12.8f / 10.f;
+    if(soc > 100.f)
+      soc = 100.f;
+    if(soc < 0.f)
+      soc = 0.f;
+
+    const Statshot_t stat = {
+      .bat_soc = soc,
+      .bat_v = 12.8f + soc * 0.006f,
+      .load_w = load_w,
+      .sol_w = sol_w,
+      .alt_w = alt_w,
+      .charged_ah = (sol_w + alt_w) / 13,
+      .discharged_ah = (uint16_t)(-load_w / 13),
+    };
+    stats_history_push(history, &stat);
+    stats_query_append(query);
+  }
+}
+
+/* A chart narrower than the history, so each column is the envelope of its
+ *  samples (stats_query_aggregate()), which the statistics page never reaches
+ */
+static void render_draw_narrow_chart() {
+  const Chart_t chart = {
+    .x0 = 121,
+    .y0 = 11,
+    .x1 = 160,
+    .y1 = 79,
+    .series = render_narrow_series,
+    .series_count = sizeof(render_narrow_series) / sizeof(render_narrow_series[0]),
+    .axes = {
+      [ChartAxisLeft] = { 0, 100, NULL },
+      [ChartAxisRight] = { 0, 0, "W" },
+    },
+    .day_samples = 24,
+  };
+
+  display_draw_rect(chart.x0 - 1, chart.y0 - 1, chart.x1 + 1, chart.y1 + 1, Black);
+  chart_draw(&chart, &render_query);
+}
+
+static void render_draw(uint8_t image) {
+  display_fill_colour(White);
+
+  if(image == PageContentsCount) {
+    render_draw_narrow_chart();
+    return;
+  }
+  update_page_static(image);
+  update_page_contents(image, &render_view, &render_query);
+}
+
+// Draw an image and send it to the panel, as update_page() does
+static void render_image_send(uint8_t image, bool banded) {
+  if(banded) {
+    display_set_list(&render_list);
+    render_draw(image);
+    display_set_list(NULL);
+    display_draw_list(&render_list);
+  } else {
+    display_set_canvas(&render_canvas);
+    render_draw(image);
+    display_send_buffer(render_black, SCREEN_W, SCREEN_H, 1);
+    display_send_buffer(render_red, SCREEN_W, SCREEN_H, 2);
+  }
+  display_refresh(false);
+}
+
+static const uint8_t* render_panel_plane(uint8_t plane) {
+  if(render_stand_in)
+    return panel_host_state()->ram[plane];
+  return uc8151_capture_state()->ram[plane];
+}
+
+// Rotate a native plane into a landscape PBM bitmap, 1 being inked
+static void render_image(const uint8_t* plane, uint8_t* image) {
+  memset(image, 0, RENDER_IMAGE_SIZE);
+
+  for(uint16_t y = 0; y < DISPLAY_W; y++) {
+    for(uint16_t x = 0; x < DISPLAY_H; x++) {
+      const uint16_t row = DISPLAY_H - 1 - x;
+      if(!(plane[row * SCREEN_W + y / 8] & (0x80 >> (y & 7))))
+        image[y * RENDER_IMAGE_STRIDE + x / 8] |= 0x80 >> (x & 7);
+    }
+  }
+}
+
+static int render_write_image(const char* path, const uint8_t* image) {
+  FILE* file = fopen(path, "wb");
+
+  if(file == NULL) {
+    printf("Unable to write %s\n", path);
+    return -1;
+  }
+
+  fprintf(file, "P4\n%d %d\n", DISPLAY_H, DISPLAY_W);
+  fwrite(image, 1, RENDER_IMAGE_SIZE, file);
+  fclose(file);
+
+  return 0;
+}
+
+// Pixels differing from the image at path, -1 when it cannot be read
+static int32_t render_compare_image(const char* path, const uint8_t* image) {
+  uint8_t expected[RENDER_IMAGE_SIZE];
+  int32_t differing = 0;
+  int width, height;
+  FILE* file = fopen(path, "rb");
+
+  if(file == NULL) {
+    printf("Unable to read %s\n", path);
+    return -1;
+  }
+
+  // the single whitespace byte after the height ends the header
+  if(fscanf(file, "P4 %d %d", &width, &height) != 2 || fgetc(file) == EOF
+      || width != DISPLAY_H || height != DISPLAY_W
+      || fread(expected, 1, RENDER_IMAGE_SIZE, file) != RENDER_IMAGE_SIZE) {
+    printf("%s is not a %dx%d PBM\n", path, DISPLAY_H, DISPLAY_W);
+    fclose(file);
+    return -1;
+  }
+  fclose(file);
+
+  for(uint32_t i = 0; i < RENDER_IMAGE_SIZE; i++) {
+    differing += __builtin_popcount(expected[i] ^ image[i]);
+  }
+  return differing;
+}
+
+// Write (or compare) every image, returns the number of mismatched planes
+static int render_pages(const char* out_dir, const char* compare_dir, bool banded) {
+  uint8_t image[RENDER_IMAGE_SIZE];
+  char path[RENDER_PATH_MAX];
+  int failures = 0;
+
+  for(uint8_t p = 0; p < RENDER_IMAGES; p++) {
+    render_image_send(p, banded);
+
+    for(uint8_t plane = 0; plane < 2; plane++) {
+      render_image(render_panel_plane(plane), image);
+
+      if(out_dir) {
+        snprintf(path, sizeof(path), "%s/%s-%s.pbm", out_dir, render_image_names[p], render_plane_names[plane]);
+        if(render_write_image(path, image) != 0)
+          failures++;
+      }
+
+      if(compare_dir) {
+        snprintf(path, sizeof(path), "%s/%s-%s.pbm", compare_dir, render_image_names[p], render_plane_names[plane]);
+        const int32_t differing = render_compare_image(path, image);
+        if(differing != 0)
+          failures++;
+        if(differing > 0)
+          printf("%s %s plane: %d pixels differ\n", render_image_names[p], render_plane_names[plane], differing);
+      }
+    }
+  }
+
+  // the controller drops data past its window, the driver should never send any
+  if(!render_stand_in && uc8151_capture_state()->overruns > 0) {
+    printf("%d bytes sent past the panel's window\n", uc8151_capture_state()->overruns);
+    failures++;
+  }
+
+  return failures;
+}
+
+static void render_hline() {
+  display_draw_line(0, 64, DISPLAY_H - 1, 64, Black);
+}
+
+static void render_vline() {
+  display_draw_line(148, 0, 148, DISPLAY_W - 1, Black);
+}
+
+static void render_diagonal() {
+  display_draw_line(0, 0, DISPLAY_H - 1, DISPLAY_W - 1, Black);
+}
+
+static void render_fill_rect() {
+  display_draw_fill(100, 30, 164, 94, Red);
+}
+
+static void render_fill_screen() {
+  display_fill_colour(White);
+}
+
+static void render_text() {
+  display_draw_text("Temperatures (C)", 10, 40, Black);
+}
+
+static void render_title() {
+  display_draw_title("Alternator", 5, 12, Black);
+}
+
+static void render_text_scaled() {
+  display_draw_font_scaled("400W", &FontNormal, 100, 38, 3 | DISPLAY_TEXT_SMOOTH, Black);
+}
+
+static void render_bitmap() {
+  display_draw_bitmap(0, DISPLAY_W - MENU_IMAGE_SIZE, &menu_home_native);
+}
+
+static const RenderPrimitive_t render_primitives[] = {
+  { "fill screen", render_fill_screen, DISPLAY_H * DISPLAY_W },
+  { "fill rect 64x64", render_fill_rect, 64 * 64 },
+  { "line horizontal", render_hline, DISPLAY_H },
+  { "line vertical", render_vline, DISPLAY_W },
+  { "line diagonal", render_diagonal, DISPLAY_H },
+  { "text 16 chars", render_text, 0 },
+  { "title 10 chars", render_title, 0 },
+  { "text 4 chars x3", render_text_scaled, 0 },
+  { "menu bitmap", render_bitmap, 0 },
+};
+
+// Time iterations renders of each page and calls of each primitive
+static void render_benchmark(uint32_t iterations) {
+  uint64_t started_at;
+
+  printf("%-12s %12s %12s %12s\n", "page", "canvas us", "list us", "commands");
+  for(uint8_t p = 0; p < PageContentsCount; p++) {
+    display_set_canvas(&render_canvas);
+    started_at = time_us_64();
+    for(uint32_t i = 0; i < iterations; i++) {
+      render_draw(p);
+    }
+    const float canvas_us = (float)(time_us_64() - started_at) / iterations;
+
+    // recorded, then rendered and sent band by band
+    started_at = time_us_64();
+    for(uint32_t i = 0; i < iterations; i++) {
+      display_set_list(&render_list);
+      render_draw(p);
+      display_set_list(NULL);
+      display_draw_list(&render_list);
+    }
+    const float list_us = (float)(time_us_64() - started_at) / iterations;
+
+    printf("%-12s %12.1f %12.1f %12d\n", render_image_names[p], canvas_us, list_us, render_list.count);
+  }
+
+  printf("\n%-18s %12s %12s\n", "primitive", "ns/call", "Mpixel/s");
+  display_set_canvas(&render_canvas);
+  for(uint8_t i = 0; i < sizeof(render_primitives) / sizeof(render_primitives[0]); i++) {
+    const RenderPrimitive_t* primitive = &render_primitives[i];
+
+    started_at = time_us_64();
+    for(uint32_t n = 0; n < iterations; n++) {
+      primitive->draw();
+    }
+    const float call_ns = (float)(time_us_64() - started_at) * 1000.f / iterations;
+
+    if(primitive->pixels > 0)
+      printf("%-18s %12.1f %12.1f\n", primitive->name, call_ns, primitive->pixels / call_ns * 1000.f);
+    else
+      printf("%-18s %12.1f %12s\n", primitive->name, call_ns, "-");
+  }
+}
+
+static void render_usage(const char* name) {
+  printf("Usage: %s [-o dir] [-c dir] [-b iterations] [-l] [-s]\n", name);
+  printf("  -o dir   write <page>-black.pbm and <page>-red.pbm into dir\n");
+  printf("  -c dir   compare with the images in dir, failing on any difference\n");
+  printf("  -b n     time n renders of each page, and n calls of each primitive\n");
+  printf("  -l       render through the display list band by band, as EPD_RENDER_BANDED\n");
+  printf("  -s       send to the panel_host stand-in, rather than the UC8151 driver\n");
+}
+
+int main(int argc, char** argv) {
+  const char* out_dir = NULL;
+  const char* compare_dir = NULL;
+  uint32_t iterations = 0;
+  bool banded = false;
+  int option;
+
+  while((option = getopt(argc, argv, "o:c:b:lsh")) != -1) {
+    switch(option) {
+      case 'o':
+        out_dir = optarg;
+        break;
+      case 'c':
+        compare_dir = optarg;
+        break;
+      case 'b':
+        iterations = strtoul(optarg, NULL, 10);
+        break;
+      case 'l':
+        banded = true;
+        break;
+      case 's':
+        render_stand_in = true;
+        break;
+      default:
+        render_usage(argv[0]);
+        return option == 'h' ? 0 : 2;
+    }
+  }
+  if(out_dir == NULL && compare_dir == NULL && iterations == 0) {
+    render_usage(argv[0]);
+    return 2;
+  }
+
+  render_fixture_init(&render_view);
+  render_history_init(&render_history, &render_query);
+  canvas_init(&render_canvas, render_black, render_red, 0, SCREEN_H);
+
+  if(!render_stand_in)
+    uc8151_capture_init();
+  if(display_init(render_stand_in ? &panel_host : &panel_uc8151_bwr) != 0)
+    return 1;
+
+  const int failures = render_pages(out_dir, compare_dir, banded);
+  if(compare_dir && failures == 0)
+    printf("All %d images match %s\n", RENDER_IMAGES, compare_dir);
+
+  if(iterations > 0)
+    render_benchmark(iterations);
+
+  return failures > 0 ? 1 : 0;
+}
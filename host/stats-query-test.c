@@ -0,0 +1,138 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "stats-query.h"
+
+/* Checks stats_query_aggregate() against a linear scan of the history
+ *  Random samples are pushed well past STATS_MAX_HISTORY, so the ring, the prefix
+ *  ring (STATS_MAX_HISTORY + 1 entries) and the segment trees all wrap, and the
+ *  solar and alternator values are kept high so the uint32 prefix sums wrap too.
+ *  After a push, random windows [t0, t1) of every series (and the windows crossing
+ *  the ring's wrap) are compared: count, sum, min, max and the mean.
+ */
+
+#define TEST_PUSHES         80000   // at over 60000W a sample, the solar prefix passes 2^32
+#define TEST_DENSE_PUSHES   400     // checked after every push, past both rings' wraps
+#define TEST_SPARSE_EVERY   97      // then after every this many
+#define TEST_WINDOWS        40      // random windows per series and check
+
+static StatsHistory_t test_history;
+static StatsQuery_t test_query;
+static uint32_t test_seed = 0x2545f491;
+static uint32_t test_windows;
+static uint32_t test_failures;
+
+static const char* test_series_names[StatSeriesCount] = {
+  [StatSoc] = "soc",
+  [StatBatteryVoltage] = "voltage",
+  [StatLoad] = "load",
+  [StatSolar] = "solar",
+  [StatAlternator] = "alternator",
+  [StatCharged] = "charged",
+  [StatDischarged] = "discharged",
+};
+
+// xorshift32, so every run checks the same samples and windows
+static uint32_t test_random(uint32_t range) {
+  test_seed ^= test_seed << 13;
+  test_seed ^= test_seed >> 17;
+  test_seed ^= test_seed << 5;
+  return test_seed % range;
+}
+
+static void test_push() {
+  const Statshot_t stat = {
+    .bat_soc = test_random(1001) / 10.f,
+    .bat_v = 11.f + test_random(400) / 100.f,
+    .load_w = (int32_t)test_random(6001) - 3000,
+    .sol_w = 60000 + test_random(5536),
+    .alt_w = test_random(2) ? 65535 : test_random(65536),
+    .charged_ah = test_random(200),
+    .discharged_ah = test_random(200),
+  };
+
+  stats_history_push(&test_history, &stat);
+  stats_query_append(&test_query);
+}
+
+static void test_window(StatSeries_t series, uint16_t t0, uint16_t t1) {
+  StatsAggregate_t expected = { t1 - t0, 0, INT32_MAX, INT32_MIN };
+  StatsAggregate_t aggregate;
+
+  for(uint16_t i = t0; i < t1; i++) {
+    const int32_t value = stats_history_value(&test_history, series, i);
+
+    expected.sum += value;
+    if(value < expected.min)
+      expected.min = value;
+    if(value > expected.max)
+      expected.max = value;
+  }
+
+  test_windows++;
+
+  // only the charted series are indexed
+  if(!stats_query_aggregate(&test_query, series, t0, t1, &aggregate)) {
+    if(series == StatSoc || series == StatLoad || series == StatSolar || series == StatAlternator) {
+      printf("%s [%d, %d) after %u samples: not answered\n", test_series_names[series], t0, t1, test_history.total);
+      test_failures++;
+    }
+    return;
+  }
+
+  if(aggregate.count != expected.count || aggregate.sum != expected.sum || aggregate.min != expected.min
+      || aggregate.max != expected.max || stats_aggregate_mean(&aggregate) != stats_aggregate_mean(&expected)) {
+    printf("%s [%d, %d) after %u samples: count %d sum %d min %d max %d, scanned %d %d %d %d\n",
+        test_series_names[series], t0, t1, test_history.total,
+        aggregate.count, aggregate.sum, aggregate.min, aggregate.max,
+        expected.count, expected.sum, expected.min, expected.max);
+    test_failures++;
+  }
+}
+
+// Windows that must be refused, past the history or empty
+static void test_refused(StatSeries_t series) {
+  const uint16_t count = test_history.count;
+  StatsAggregate_t aggregate;
+
+  if(stats_query_aggregate(&test_query, series, 0, count + 1, &aggregate)
+      || stats_query_aggregate(&test_query, series, count, count, &aggregate)) {
+    printf("%s after %u samples: answered a window outside [0, %d)\n", test_series_names[series], test_history.total, count);
+    test_failures++;
+  }
+}
+
+static void test_check() {
+  const uint16_t count = test_history.count;
+
+  // the sample in the ring's first slot, those before it are at the ring's end
+  const uint16_t wrap = STATS_MAX_HISTORY - stats_history_slot(&test_history, 0);
+
+  for(uint8_t s = 0; s < StatSeriesCount; s++) {
+    test_refused(s);
+    test_window(s, 0, count);
+
+    if(wrap > 0 && wrap < count)
+      test_window(s, test_random(wrap), wrap + 1 + test_random(count - wrap));
+
+    for(uint8_t w = 0; w < TEST_WINDOWS; w++) {
+      const uint16_t t0 = test_random(count);
+      test_window(s, t0, t0 + 1 + test_random(count - t0));
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  stats_history_init(&test_history);
+  stats_query_init(&test_query, &test_history);
+
+  for(uint32_t n = 1; n <= TEST_PUSHES; n++) {
+    test_push();
+    if(n <= TEST_DENSE_PUSHES || n % TEST_SPARSE_EVERY == 0)
+      test_check();
+  }
+
+  printf("%u windows over %u samples, %u mismatched\n", test_windows, test_history.total, test_failures);
+
+  return test_failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,96 @@
+#include "pico-host.h"
+#include "uc8151-capture.h"
+
+/* Decodes the command stream of a UC8151 from the SPI bytes the host stubs see
+ *  Data after EPD_DATA_START_TRANSMISSION_1 and 2 fills the black and red RAM row
+ *  by row, within the EPD_PARTIAL_WINDOW while in partial mode (EPD_PARTIAL_IN)
+ *  and the whole screen otherwise, as the controller itself would. Only the
+ *  commands that place pixels are decoded, the rest are skipped with their data.
+ */
+
+#define UC8151_CAPTURE_WINDOW_SIZE  7
+
+static Uc8151Capture_t uc8151_capture;
+static uint8_t uc8151_capture_command;
+static uint32_t uc8151_capture_count;     // data bytes since the command
+static bool uc8151_capture_partial;
+static uint8_t uc8151_capture_window[UC8151_CAPTURE_WINDOW_SIZE];
+
+// The window data goes into, in native bytes and rows (HRST/HRED are in pixels)
+static CanvasRect_t uc8151_capture_region() {
+  const uint8_t* window = uc8151_capture_window;
+
+  if(!uc8151_capture_partial)
+    return (CanvasRect_t){ 0, SCREEN_W - 1, 0, SCREEN_H - 1 };
+
+  return (CanvasRect_t){
+    window[0] >> 3,
+    window[1] >> 3,
+    (window[2] & 0x01) << 8 | window[3],
+    (window[4] & 0x01) << 8 | window[5],
+  };
+}
+
+static void uc8151_capture_pixels(uint8_t plane, uint8_t value) {
+  const CanvasRect_t region = uc8151_capture_region();
+  const uint16_t line_bytes = region.byte_end - region.byte_start + 1;
+  const uint32_t row = region.row_start + uc8151_capture_count / line_bytes;
+  const uint32_t byte = region.byte_start + uc8151_capture_count % line_bytes;
+
+  if(row > region.row_end || row >= SCREEN_H || byte >= SCREEN_W) {
+    uc8151_capture.overruns++;
+    return;
+  }
+
+  uc8151_capture.ram[plane][row * SCREEN_W + byte] = value;
+  uc8151_capture.bytes_written++;
+}
+
+static void uc8151_capture_byte(uint8_t byte, bool data) {
+  if(!data) {
+    uc8151_capture_command = byte;
+    uc8151_capture_count = 0;
+
+    switch(byte) {
+      case EPD_PARTIAL_IN:
+        uc8151_capture_partial = true;
+        break;
+      case EPD_PARTIAL_OUT:
+        uc8151_capture_partial = false;
+        break;
+      case EPD_DISPLAY_REFRESH:
+        uc8151_capture.refreshes++;
+        break;
+      default:
+        break;
+    }
+    return;
+  }
+
+  switch(uc8151_capture_command) {
+    case EPD_DATA_START_TRANSMISSION_1:
+      uc8151_capture_pixels(0, byte);
+      break;
+    case EPD_DATA_START_TRANSMISSION_2:
+      uc8151_capture_pixels(1, byte);
+      break;
+    case EPD_PARTIAL_WINDOW:
+      if(uc8151_capture_count < UC8151_CAPTURE_WINDOW_SIZE)
+        uc8151_capture_window[uc8151_capture_count] = byte;
+      break;
+    default:
+      break;
+  }
+  uc8151_capture_count++;
+}
+
+// Start capturing from the bytes sent to SPI_PIN_DC's panel
+void uc8151_capture_init() {
+  memset(&uc8151_capture, 0, sizeof(uc8151_capture));
+  uc8151_capture_partial = false;
+  pico_host_spi_capture(SPI_PIN_DC, uc8151_capture_byte);
+}
+
+const Uc8151Capture_t* uc8151_capture_state() {
+  return &uc8151_capture;
+}
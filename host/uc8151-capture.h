@@ -0,0 +1,16 @@
+#pragma once
+
+#include "display.h"
+
+/* The RAM of a UC8151 controller, decoded from the SPI bytes sent to it
+ *  Lets render_pages run the real panel_uc8151_bwr driver, see uc8151-capture.c.
+ */
+typedef struct {
+  uint8_t ram[2][SCREEN_W * SCREEN_H];  // DTM1 (black) and DTM2 (red), native rows
+  uint32_t refreshes;
+  uint32_t bytes_written;
+  uint32_t overruns;                    // data past the end of the window, dropped
+} Uc8151Capture_t;
+
+void uc8151_capture_init();
+const Uc8151Capture_t* uc8151_capture_state();
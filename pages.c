@@ -0,0 +1,384 @@
+#include "pages.h"
+
+float battery_max_capacity(const uint16_t* lfp100s) {
+  uint16_t reg1 = lfp100s[LFP100S_REG_MAX_CAPACITY_1];
+  uint16_t reg2 = lfp100s[LFP100S_REG_MAX_CAPACITY_2];
+  float battery_max_capacity = ((reg1 << 15) | (reg2 >> 1));
+
+  return battery_max_capacity * 0.002f;
+}
+
+float battery_capacity(const uint16_t* lfp100s) {
+  uint16_t reg1 = lfp100s[LFP100S_REG_CAPACITY_1];
+  uint16_t reg2 = lfp100s[LFP100S_REG_CAPACITY_2];
+  uint16_t capacity = ((reg1 << 15) | (reg2 >> 1));
+
+  return capacity * 0.002f;
+}
+
+float battery_percentage(const uint16_t* lfp100s) {
+  float max = battery_max_capacity(lfp100s);
+  float cap = battery_capacity(lfp100s);
+  float percent = (cap / max) * 100.0;
+
+  return percent;
+}
+
+float battery_amperes(const uint16_t* lfp100s) {
+  uint16_t amps = lfp100s[LFP100S_REG_LOAD_A];
+
+  if(amps < 61440)
+    return (float)amps / 100.0;
+  else
+    return (float)(amps - 65535) / 100.0;
+}
+
+float battery_voltage(const uint16_t* lfp100s) {
+  uint16_t v = lfp100s[LFP100S_REG_VOLTAGE];
+  return (float)v / 10.f;
+}
+
+float battery_load_watts(const uint16_t* lfp100s) {
+  float a = battery_amperes(lfp100s);
+  float v = battery_voltage(lfp100s);
+  return a * v;
+}
+
+float solar_voltage(const uint16_t* rvr40) {
+  uint16_t v = rvr40[RVR40_REG_SOLAR_V];
+  return (float)v / 10.f;
+}
+
+float solar_amperage(const uint16_t* rvr40) {
+  uint16_t a = rvr40[RVR40_REG_SOLAR_A];
+  return (float)a / 100.f;
+}
+
+void calculate_temperatures(uint16_t state, uint16_t* internal, uint16_t* aux) {
+  *internal = (state >> 8);
+  *aux = (state & 0xff);
+}
+
+void get_charge_status(const uint16_t* lfp100s, Format_t* line) {
+  float load_amps = battery_amperes(lfp100s);
+
+  if(load_amps > 0) {
+    format_text(line, "Charging");
+  } else {
+    format_text(line, "Discharging");
+  }
+}
+
+void update_page_overview(const Snapshot_t* view) {
+  char buffer[32];
+  Format_t line;
+
+  uint16_t alt_w = view->dcc50s[DCC50S_REG_ALT_W];
+  uint16_t sol_w = view->rvr40[RVR40_REG_SOLAR_W];
+
+  float bat_soc = battery_percentage(view->lfp100s);
+
+  // Draw the main battery state
+  format_init(&line, buffer, sizeof(buffer));
+  get_charge_status(view->lfp100s, &line);
+  display_draw_title(buffer, 5, 12, Black);
+
+  // Battery SOC% and voltage (register in 0.1V), the SoC is NaN until the battery has been read
+  format_init(&line, buffer, sizeof(buffer));
+  if(isnan(bat_soc)) {
+    format_text(&line, "--");
+    format_unit(&line, UnitPercent);
+  } else {
+    format_fixed(&line, to_centi(bat_soc), 2, 0, UnitPercent);
+  }
+  display_draw_title(buffer, DISPLAY_H / 2 - 5, DISPLAY_W / 3 + 3, Black);
+  format_init(&line, buffer, sizeof(buffer));
+  format_fixed(&line, view->lfp100s[LFP100S_REG_VOLTAGE], 1, 2, UnitVolts);
+  display_draw_text(buffer, DISPLAY_H / 2, DISPLAY_W / 3 + 30, Black);
+
+  format_init(&line, buffer, sizeof(buffer));
+  format_int(&line, alt_w, UnitWatts);
+  display_draw_text(buffer, 100, 50, Black);
+
+  format_init(&line, buffer, sizeof(buffer));
+  format_int(&line, sol_w, UnitWatts);
+  display_draw_text(buffer, 100, 70, Black);
+}
+
+// Left edge of the daily stats block, the headline watts must end before it
+#define SOLAR_STATS_X     (DISPLAY_H / 2 + 15)
+#define SOLAR_HEADLINE_X  100
+#define SOLAR_LINE_Y      56
+
+void update_page_solar(const Snapshot_t* view) {
+  char buffer[32];
+  Format_t line;
+
+  uint16_t sol_w = view->rvr40[RVR40_REG_SOLAR_W];
+  uint16_t temperature_ctrl, temperature_aux;
+
+  // registers in 0.01A and 0.1V
+  format_init(&line, buffer, sizeof(buffer));
+  format_text(&line, "+ ");
+  format_fixed(&line, view->rvr40[RVR40_REG_SOLAR_A], 2, 1, UnitAmps);
+  display_draw_text(buffer, 5, 50, Black);
+
+  format_init(&line, buffer, sizeof(buffer));
+  format_fixed(&line, view->rvr40[RVR40_REG_SOLAR_V], 1, 1, UnitVolts);
+  display_draw_text(buffer, 50, 50, Black);
+
+  // headline watts at up to three times FontNormal, centred on the line of the readings
+  //  scaled glyphs are opaque, so a wider reading drops a scale rather than cover the labels
+  format_init(&line, buffer, sizeof(buffer));
+  format_int(&line, sol_w, UnitWatts);
+  uint8_t scale = 3;
+  while(scale > 1 && SOLAR_HEADLINE_X + display_text_width(buffer) * scale >= SOLAR_STATS_X)
+    scale--;
+  display_draw_font_scaled(buffer, &FontNormal, SOLAR_HEADLINE_X, SOLAR_LINE_Y - FontNormal.font_height * scale / 2,
+      scale | DISPLAY_TEXT_SMOOTH, Black);
+
+  // right aligned, so the units line up
+  format_init(&line, buffer, sizeof(buffer));
+  format_int(&line, view->rvr40[RVR40_REG_DAY_CHG_AMPHRS], UnitAmpHours);
+  format_align_right(&line, 5);
+  display_draw_text(buffer, DISPLAY_H - 35, 45, Black);
+
+  format_init(&line, buffer, sizeof(buffer));
+  format_int(&line, view->rvr40[RVR40_REG_DAY_DCHG_AMPHRS], UnitAmpHours);
+  format_align_right(&line, 5);
+  display_draw_text(buffer, DISPLAY_H - 35, 60, Black);
+
+  calculate_temperatures(view->rvr40[RVR40_REG_TEMPERATURE], &temperature_ctrl, &temperature_aux);
+  format_init(&line, buffer, sizeof(buffer));
+  format_text(&line, "RVR: ");
+  format_int(&line, temperature_ctrl, UnitNone);
+  format_text(&line, ", Bat: ");
+  format_int(&line, temperature_aux, UnitNone);
+  display_draw_text(buffer, DISPLAY_H / 2 + 25, 95, Black);
+}
+
+void update_page_alternator(const Snapshot_t* view) {
+  char buffer[32];
+  Format_t line;
+
+  uint16_t alt_a = view->dcc50s[DCC50S_REG_ALT_A];
+  uint16_t alt_v = view->dcc50s[DCC50S_REG_ALT_V];
+  uint16_t alt_w = view->dcc50s[DCC50S_REG_ALT_W];
+  uint16_t day_total_ah = view->dcc50s[DCC50S_REG_DAY_TOTAL_AH];
+  uint16_t temperatures = view->dcc50s[RVR40_REG_TEMPERATURE];
+  uint16_t temperature_ctrl, temperature_aux;
+
+  format_init(&line, buffer, sizeof(buffer));
+  format_int(&line, alt_a, UnitAmps);
+  display_draw_text(buffer, DISPLAY_H / 2 + 20, 53, Black);
+
+  format_init(&line, buffer, sizeof(buffer));
+  format_int(&line, alt_v, UnitVolts);
+  display_draw_text(buffer, DISPLAY_H / 2 + 40, 53, Black);
+
+  format_init(&line, buffer, sizeof(buffer));
+  format_int(&line, alt_w, UnitWatts);
+  display_draw_title(buffer, DISPLAY_H / 2 + 80, 50, Black);
+
+  format_init(&line, buffer, sizeof(buffer));
+  format_int(&line, day_total_ah, UnitAmpHours);
+  format_text(&line, " today");
+  display_draw_text(buffer, DISPLAY_H / 2 + 25, 65, Black);
+
+  calculate_temperatures(temperatures, &temperature_ctrl, &temperature_aux);
+  format_init(&line, buffer, sizeof(buffer));
+  format_text(&line, "DCC: ");
+  format_int(&line, temperature_ctrl, UnitNone);
+  format_text(&line, ", Bat: ");
+  format_int(&line, temperature_aux, UnitNone);
+  display_draw_text(buffer, 20, 55, Black);
+}
+
+void update_menu(PageContents_t page) {
+  const uint16_t size = MENU_IMAGE_SIZE;
+  const uint16_t menu_y = DISPLAY_W - MENU_IMAGE_SIZE;
+
+  display_draw_bitmap(0, menu_y, &menu_home_native);
+  display_draw_bitmap(size, menu_y, &menu_solar_native);
+  display_draw_bitmap(size * 2, menu_y, &menu_alternator_native);
+  display_draw_bitmap(size * 3, menu_y, &menu_stats_native);
+
+  switch(page) {
+    case Overview:
+      display_draw_rect(0, menu_y, size, DISPLAY_W - 1, Black);
+      break;
+    case Solar:
+      display_draw_rect(size, menu_y, size * 2, DISPLAY_W - 1, Black);
+      break;
+    case Alternator:
+      display_draw_rect(size * 2, menu_y, size * 3, DISPLAY_W - 1, Black);
+      break;
+    case Statistics:
+      display_draw_rect(size * 3, menu_y, size * 4, DISPLAY_W - 1, Black);
+      break;
+    default:
+      break;
+  }
+}
+
+// Hours below a day, days above
+static void format_duration(Format_t* line, float hours) {
+  if(hours < 24) {
+    format_fixed(line, to_centi(hours), 2, 2, UnitHours);
+  } else {
+    format_fixed(line, to_centi(hours / 24.f), 2, 2, UnitDays);
+  }
+}
+
+void update_page_overview_battery(const Snapshot_t* view) {
+  const uint16_t third_x = DISPLAY_H / 3;
+  const uint16_t third_y = DISPLAY_W / 3;
+  char buffer[32];
+  Format_t line;
+
+  float percent = battery_percentage(view->lfp100s);
+  float capacity = battery_capacity(view->lfp100s);
+  float unit_percent = percent / 100.0;
+  uint16_t battery_width = isnan(unit_percent) ? 0 : (uint16_t)(((DISPLAY_H - 20) - (third_x * 2 - 4)) * unit_percent);
+
+  // Draw battery outline and contents
+  //  the outline stays dynamic, a 100% SoC title overlaps its left edge
+  display_draw_rect(third_x * 2, third_y, DISPLAY_H - 20, third_y * 2, Black);
+  display_draw_fill(third_x * 2 + 2, third_y + 2, third_x * 2 + battery_width, third_y * 2 - 1,
+      percent > 25.0 ? Black : Red);
+
+  // Use rolling average load in watts over the last STATS_UPDATE_ROLLING_MS period
+  // Can use battery_load_watts() for current point in time of update
+  float load_w = view->rolling.load_w;
+  const int32_t load_cw = to_centi(load_w);
+  format_init(&line, buffer, sizeof(buffer));
+  format_sign(&line, load_cw);
+  format_fixed(&line, load_cw, 2, 2, UnitWatts);
+  display_draw_text(buffer, third_x * 2, third_y - 20, Black);
+
+  // Determine time until discharged or full
+  if(load_w != 0) {
+    format_init(&line, buffer, sizeof(buffer));
+
+    if(load_w < 0) {
+      float hrs_left = 10.0 * capacity / -load_w;
+      if(hrs_left != INFINITY) {
+        format_text(&line, "empty ");
+        format_duration(&line, hrs_left);
+        if(hrs_left < 12) {
+          display_draw_text(buffer, third_x * 2, third_y * 2 + 10, Red);
+        } else {
+          display_draw_text(buffer, third_x * 2, third_y * 2 + 10, Black);
+        }
+      }
+    } else {
+      float hrs_full = 10.0 * capacity / load_w;
+
+      if(hrs_full != INFINITY && hrs_full != 0) {
+        format_text(&line, "full ");
+        format_duration(&line, hrs_full);
+        display_draw_text(buffer, third_x * 2, third_y * 2 + 10, Black);
+      }
+    }
+  }
+}
+
+#define PLOT_X_START  25
+#define PLOT_HEIGHT   (DISPLAY_W - MENU_IMAGE_SIZE - 25)
+
+// SoC (and its daily means) on the fixed left axis, over the power flows on a fitted right axis
+static const ChartSeries_t statistics_series[] = {
+  { StatLoad, Black, ChartDotted, ChartAxisRight },
+  { StatAlternator, Red, ChartDotted, ChartAxisRight },
+  { StatSolar, Red, ChartLine, ChartAxisRight },
+  { StatSoc, Black, ChartLine, ChartAxisLeft },
+  { StatSoc, Red, ChartDayMean, ChartAxisLeft },
+};
+
+void update_page_statistics(const StatsQuery_t* query) {
+  const Chart_t chart = {
+    .x0 = PLOT_X_START + 1,
+    .y0 = 1,
+    .x1 = DISPLAY_H - 2,
+    .y1 = PLOT_HEIGHT - 1,
+    .series = statistics_series,
+    .series_count = sizeof(statistics_series) / sizeof(statistics_series[0]),
+    .axes = {
+      [ChartAxisLeft] = { 0, 100, NULL },
+      [ChartAxisRight] = { 0, 0, "W" },
+    },
+    .day_samples = 24,
+  };
+
+  chart_draw(&chart, query);
+
+  // Determine if we are labelling days or hours, by the history's length
+  if(chart_in_days(&chart, query->history->count)) {
+    display_draw_title("Daily", DISPLAY_H - 80, DISPLAY_W - 20, Black);
+  } else {
+    display_draw_title("Hourly", DISPLAY_H - 96, DISPLAY_W - 20, Black);
+  }
+}
+
+// Everything on a page that does not depend on the data, drawn once per page
+void update_page_static(PageContents_t p) {
+  update_menu(p);
+
+  switch(p) {
+    case Overview:
+      display_draw_text("Alternator", 10, 50, Black);
+      display_draw_text("Solar", 10, 70, Black);
+      break;
+
+    case Alternator:
+      display_draw_title("Alternator", 5, 12, Black);
+      display_draw_text("Charge Status", DISPLAY_H / 2 + 20, 30, Black);
+      display_draw_text("Temperatures (C)", 10, 40, Black);
+      break;
+
+    case Solar:
+      display_draw_title("Solar", 5, 12, Black);
+      display_draw_text("Daily Stats", SOLAR_STATS_X, 30, Black);
+      display_draw_text("Charged", SOLAR_STATS_X + 10, 45, Black);
+      display_draw_text("Discharged", SOLAR_STATS_X + 10, 60, Black);
+      display_draw_text("Temperatures (C)", DISPLAY_H / 2 + 15, 80, Black);
+      break;
+
+    case Statistics:
+      // Draw chart with axis
+      display_draw_rect(PLOT_X_START, 0, DISPLAY_H - 1, PLOT_HEIGHT, Black);
+      display_draw_text("0", 5, PLOT_HEIGHT - 5, Black);
+      display_draw_text("%", 5, PLOT_HEIGHT / 2, Black);
+      display_draw_text("100", 0, 0, Black);
+      break;
+
+    default:
+      break;
+  }
+}
+
+// Draw the values of a page
+void update_page_contents(PageContents_t p, const Snapshot_t* view, const StatsQuery_t* query) {
+  switch(p) {
+    case Overview:
+      update_page_overview(view);
+      update_page_overview_battery(view);
+      break;
+
+    case Alternator:
+      update_page_alternator(view);
+      break;
+
+    case Solar:
+      update_page_solar(view);
+      break;
+
+    case Statistics:
+      update_page_statistics(query);
+      break;
+
+    default:
+      display_draw_title("404", 5, 12, Black);
+      break;
+  }
+}
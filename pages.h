@@ -0,0 +1,47 @@
+#pragma once
+
+#include <math.h>
+
+#include "display/display.h"
+#include "snapshot.h"
+#include "stats-query.h"
+#include "chart.h"
+#include "format.h"
+
+typedef enum {
+  Overview,
+  Solar,
+  Alternator,
+  Statistics,
+  PageContentsCount,
+} PageContents_t;
+
+// Hundredths of a reading, rounded and clamped for format_fixed(), 0 when there is none (NaN)
+inline static int32_t to_centi(float value) {
+  if(isnan(value))
+    return 0;
+  if(value > 2e7f)
+    return 2000000000;
+  if(value < -2e7f)
+    return -2000000000;
+
+  return (int32_t)(value * 100.f + (value < 0 ? -0.5f : 0.5f));
+}
+
+float battery_max_capacity(const uint16_t* lfp100s);
+float battery_capacity(const uint16_t* lfp100s);
+float battery_percentage(const uint16_t* lfp100s);
+float battery_amperes(const uint16_t* lfp100s);
+float battery_voltage(const uint16_t* lfp100s);
+float battery_load_watts(const uint16_t* lfp100s);
+float solar_voltage(const uint16_t* rvr40);
+float solar_amperage(const uint16_t* rvr40);
+void calculate_temperatures(uint16_t state, uint16_t* internal, uint16_t* aux);
+void get_charge_status(const uint16_t* lfp100s, Format_t* line);
+
+/* Drawing of the pages, through the display_draw_* API
+ *  Pages only read the snapshot (and statistics) they are given, so they can be
+ *  rendered from fixtures as well as from the live data.
+ */
+void update_page_static(PageContents_t p);
+void update_page_contents(PageContents_t p, const Snapshot_t* view, const StatsQuery_t* query);
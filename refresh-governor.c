@@ -0,0 +1,127 @@
+#include "refresh-governor.h"
+
+static RefreshGovernor_t governor;
+
+static const char* decision_names[RefreshDecisionCount] = {
+  "hold", "initial", "requested", "significant", "fault", "interval", "rate limited",
+};
+
+void refresh_governor_init(uint32_t interval_ms, uint32_t max_interval_ms, uint32_t min_spacing_ms) {
+  memset(&governor, 0, sizeof(RefreshGovernor_t));
+
+  governor.base_interval_us = interval_ms * 1000;
+  governor.max_interval_us = max_interval_ms * 1000;
+  governor.min_spacing_us = min_spacing_ms * 1000;
+  governor.interval_us = governor.base_interval_us;
+}
+
+// A reading (NaN when there is none) appearing or going away is always significant
+static bool has_changed(float shown, float input, float threshold) {
+  if(isnan(shown) || isnan(input))
+    return isnan(shown) != isnan(input);
+
+  return fabsf(input - shown) >= threshold;
+}
+
+static bool is_significant(const RefreshInputs_t* inputs) {
+  const RefreshInputs_t* shown = &governor.shown;
+
+  return has_changed(shown->bat_soc, inputs->bat_soc, REFRESH_SOC_THRESHOLD)
+    || has_changed(shown->load_w, inputs->load_w, REFRESH_POWER_THRESHOLD)
+    || has_changed(shown->sol_w, inputs->sol_w, REFRESH_POWER_THRESHOLD)
+    || has_changed(shown->alt_w, inputs->alt_w, REFRESH_POWER_THRESHOLD);
+}
+
+RefreshDecision_t refresh_governor_decide(const RefreshInputs_t* inputs, uint64_t now_us) {
+  RefreshDecision_t decision;
+
+  // a first frame straight away, and another once the first data is published
+  if(!governor.shown_valid && (!governor.rendered || inputs->published)) {
+    decision = RefreshInitial;
+  } else if(governor.requested) {
+    decision = RefreshRequested;
+  } else if(!governor.shown_valid) {
+    decision = RefreshHold;
+  } else if(inputs->faults & ~governor.shown.faults) {
+    decision = RefreshFault;
+  } else if(is_significant(inputs)) {
+    decision = RefreshSignificant;
+  } else if(now_us >= governor.evaluated_at + governor.interval_us) {
+    decision = RefreshInterval;
+  } else {
+    decision = RefreshHold;
+  }
+
+  // the minimum spacing only applies to refreshes the user did not ask for
+  if(decision != RefreshHold && decision != RefreshInitial && decision != RefreshRequested
+      && now_us < governor.refreshed_at + governor.min_spacing_us) {
+    decision = RefreshRateLimited;
+  }
+
+  // count transitions rather than every evaluation, the main loop evaluates after each task
+  if(decision != governor.last_decision) {
+    governor.decisions[decision]++;
+  }
+  governor.last_decision = decision;
+
+  return decision;
+}
+
+// Render on the next evaluation regardless of the thresholds or spacing
+void refresh_governor_request() {
+  governor.requested = true;
+}
+
+// A frame was rendered for decision, refreshed is false when it matched what the panel shows
+void refresh_governor_rendered(const RefreshInputs_t* inputs, RefreshDecision_t decision, bool refreshed, uint64_t now_us) {
+  governor.shown = *inputs;
+  governor.rendered = true;
+  governor.shown_valid = inputs->published;
+  governor.requested = false;
+  governor.evaluated_at = now_us;
+
+  if(refreshed) {
+    governor.refreshed_at = now_us;
+    governor.refreshes++;
+  } else {
+    governor.unchanged++;
+  }
+
+  // back off while only the interval is driving refreshes
+  if(decision == RefreshInterval) {
+    governor.interval_us = governor.interval_us * 2 > governor.max_interval_us
+      ? governor.max_interval_us : governor.interval_us * 2;
+  } else {
+    governor.interval_us = governor.base_interval_us;
+  }
+
+  // start the next evaluation from a fresh transition
+  governor.last_decision = RefreshHold;
+}
+
+// Time the governor next needs evaluating, when nothing significant happens before then
+uint64_t refresh_governor_next() {
+  const uint64_t interval_at = governor.evaluated_at + governor.interval_us;
+  const uint64_t spacing_at = governor.refreshed_at + governor.min_spacing_us;
+
+  if(governor.last_decision == RefreshRateLimited)
+    return spacing_at;
+
+  return interval_at > spacing_at ? interval_at : spacing_at;
+}
+
+const RefreshGovernor_t* refresh_governor_state() {
+  return &governor;
+}
+
+const char* refresh_governor_decision_name(RefreshDecision_t decision) {
+  return decision < RefreshDecisionCount ? decision_names[decision] : "unknown";
+}
+
+void refresh_governor_print_stats() {
+  printf("Refresh interval: %lums, refreshes: %lu, unchanged: %lu\n",
+      governor.interval_us / 1000, governor.refreshes, governor.unchanged);
+  for(uint8_t i = 0; i < RefreshDecisionCount; i++) {
+    printf("  %-13s %lu\n", decision_names[i], governor.decisions[i]);
+  }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <pico/stdlib.h>
+
+// Changes in displayed quantities since the last refresh that warrant a new one
+#define REFRESH_SOC_THRESHOLD     1.f     // percent
+#define REFRESH_POWER_THRESHOLD   20.f    // watts, load, solar and alternator
+
+typedef enum {
+  RefreshHold,            // nothing significant changed and the interval has not elapsed
+  RefreshInitial,         // nothing shown yet, or only the frame from before the first data
+  RefreshRequested,       // the content changed, e.g. a new page was selected
+  RefreshSignificant,     // a displayed quantity crossed its threshold
+  RefreshFault,           // a new error bit was raised
+  RefreshInterval,        // the (backed off) interval elapsed
+  RefreshRateLimited,     // would refresh, but the panel's minimum spacing has not passed
+  RefreshDecisionCount,
+} RefreshDecision_t;
+
+// Displayed quantities the governor watches
+typedef struct {
+  float bat_soc;
+  float load_w;
+  float sol_w;
+  float alt_w;
+  uint64_t faults;        // error registers of the chargers, one bit per fault
+  bool published;         // read from published data, the SoC is NaN before the first
+} RefreshInputs_t;
+
+/* Decides when the e-ink panel should be refreshed
+ *  Crossing a threshold (or a new fault) refreshes straight away, otherwise the
+ *  panel is refreshed once per interval. The interval doubles after each refresh
+ *  triggered by the interval alone, up to a maximum, and returns to the base
+ *  interval after a significant change. No refresh is started within the minimum
+ *  spacing of the previous one.
+ */
+typedef struct {
+  uint32_t interval_us;
+  uint32_t base_interval_us;
+  uint32_t max_interval_us;
+  uint32_t min_spacing_us;
+
+  bool requested;
+  bool rendered;                  // any frame, even one from before the first data
+  bool shown_valid;               // shown holds published inputs
+  RefreshInputs_t shown;          // inputs as of the last refresh
+  uint64_t evaluated_at;          // last time a frame was rendered
+  uint64_t refreshed_at;          // last time the panel was refreshed
+
+  // Decision statistics, for tuning
+  RefreshDecision_t last_decision;
+  uint32_t decisions[RefreshDecisionCount];
+  uint32_t refreshes;
+  uint32_t unchanged;             // rendered, but the frame matched the panel
+} RefreshGovernor_t;
+
+void refresh_governor_init(uint32_t interval_ms, uint32_t max_interval_ms, uint32_t min_spacing_ms);
+RefreshDecision_t refresh_governor_decide(const RefreshInputs_t* inputs, uint64_t now_us);
+void refresh_governor_request();
+void refresh_governor_rendered(const RefreshInputs_t* inputs, RefreshDecision_t decision, bool refreshed, uint64_t now_us);
+uint64_t refresh_governor_next();
+const RefreshGovernor_t* refresh_governor_state();
+const char* refresh_governor_decision_name(RefreshDecision_t decision);
+void refresh_governor_print_stats();
+
+inline static bool refresh_governor_should_render(RefreshDecision_t decision) {
+  return decision != RefreshHold && decision != RefreshRateLimited;
+}
@@ -0,0 +1,116 @@
+#include "scheduler.h"
+
+static SchedulerTask_t tasks[SCHEDULER_MAX_TASKS];
+static uint8_t task_count;
+
+SchedulerTask_t* scheduler_add(const char* name, SchedulerRun_t run, uint32_t deadline_ms) {
+  if(task_count >= SCHEDULER_MAX_TASKS) {
+    printf("Unable to add task %s, scheduler is full\n", name);
+    return NULL;
+  }
+
+  SchedulerTask_t* task = &tasks[task_count++];
+  task->name = name;
+  task->run = run;
+  task->deadline_us = deadline_ms * 1000;
+
+  return task;
+}
+
+/* Safe to call from interrupt context on core 0
+ *  Not from core 1, the pending flag and 64 bit release time are not written
+ *  atomically across cores. Core 1 posts an event for core 0 to release the task.
+ */
+void scheduler_post(SchedulerTask_t* task) {
+  if(task->pending) {
+    task->coalesced++;
+    return;
+  }
+
+  task->released_at = time_us_64();
+  task->pending = true;
+
+  // wake the main loop if it is waiting for work
+  __sev();
+}
+
+static bool scheduler_timer_callback(struct repeating_timer* t) {
+  scheduler_post((SchedulerTask_t*)t->user_data);
+
+  return true;
+}
+
+int scheduler_add_periodic(SchedulerTask_t* task, uint32_t period_ms) {
+  if(!add_repeating_timer_ms(period_ms, scheduler_timer_callback, task, &task->timer)) {
+    printf("Unable to initialise timer for task %s\n", task->name);
+    return -1;
+  }
+
+  return 0;
+}
+
+// Run the pending task with the earliest deadline, returns false if nothing was pending
+bool scheduler_run_next() {
+  SchedulerTask_t* next = NULL;
+  uint64_t next_deadline = UINT64_MAX;
+
+  for(uint8_t i = 0; i < task_count; i++) {
+    SchedulerTask_t* task = &tasks[i];
+    if(!task->pending)
+      continue;
+
+    uint64_t deadline = task->released_at + task->deadline_us;
+    if(deadline < next_deadline) {
+      next = task;
+      next_deadline = deadline;
+    }
+  }
+
+  if(next == NULL)
+    return false;
+
+  const uint64_t released_at = next->released_at;
+  const uint64_t started_at = time_us_64();
+  next->pending = false;
+
+  next->run();
+
+  const uint64_t finished_at = time_us_64();
+  const uint32_t latency_us = started_at - released_at;
+
+  next->runs++;
+  next->last_us = finished_at - started_at;
+  if(next->last_us > next->max_us)
+    next->max_us = next->last_us;
+  if(latency_us > next->max_latency_us)
+    next->max_latency_us = latency_us;
+
+  if(finished_at > next_deadline) {
+    next->misses++;
+#ifdef _VERBOSE
+    printf("Task %s missed its deadline by %lluus\n", next->name, finished_at - next_deadline);
+#endif
+  }
+
+  return true;
+}
+
+// Sleep until an interrupt (or scheduler_post) signals there may be work, or until_us passes
+void scheduler_wait(uint64_t until_us) {
+  for(uint8_t i = 0; i < task_count; i++) {
+    if(tasks[i].pending)
+      return;
+  }
+
+  best_effort_wfe_or_timeout(from_us_since_boot(until_us));
+}
+
+void scheduler_print_stats() {
+  printf("Task         runs  miss  coal  last(us)   max(us)   max latency(us)\n");
+  for(uint8_t i = 0; i < task_count; i++) {
+    const SchedulerTask_t* task = &tasks[i];
+    printf("%-12s %-5lu %-5lu %-5lu %-10lu %-10lu %lu\n",
+        task->name, task->runs, task->misses, task->coalesced,
+        task->last_us, task->max_us, task->max_latency_us);
+  }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdio.h>
+
+#include <pico/stdlib.h>
+#include <hardware/sync.h>
+
+#define SCHEDULER_MAX_TASKS   8
+
+typedef void (*SchedulerRun_t)();
+
+/* Cooperative task, run to completion from the main loop
+ *  Timers (and other interrupts on core 0) only release a task with scheduler_post(),
+ *  the main loop then runs released tasks earliest deadline first.
+ */
+typedef struct {
+  const char* name;
+  SchedulerRun_t run;
+  uint32_t deadline_us;           // relative to release
+
+  volatile bool pending;
+  volatile uint64_t released_at;
+  struct repeating_timer timer;
+
+  // Run time statistics
+  uint32_t runs;
+  uint32_t coalesced;             // released again while still pending
+  uint32_t misses;                // completed after the deadline
+  uint32_t last_us;
+  uint32_t max_us;
+  uint32_t max_latency_us;        // release to start
+} SchedulerTask_t;
+
+SchedulerTask_t* scheduler_add(const char* name, SchedulerRun_t run, uint32_t deadline_ms);
+int scheduler_add_periodic(SchedulerTask_t* task, uint32_t period_ms);
+void scheduler_post(SchedulerTask_t* task);
+bool scheduler_run_next();
+void scheduler_wait(uint64_t until_us);
+void scheduler_print_stats();
@@ -0,0 +1,30 @@
+#include "snapshot.h"
+
+void snapshot_publish(SnapshotLock_t* lock, const Snapshot_t* snapshot) {
+  lock->sequence++;
+  __dmb();
+
+  memcpy(&lock->data, snapshot, sizeof(Snapshot_t));
+
+  __dmb();
+  lock->sequence++;
+}
+
+// Copy out the latest complete snapshot, returns its sequence number
+uint32_t snapshot_read(const SnapshotLock_t* lock, Snapshot_t* snapshot) {
+  uint32_t before, after;
+
+  do {
+    before = lock->sequence;
+    if(before & 1)
+      continue;
+    __dmb();
+
+    memcpy(snapshot, &lock->data, sizeof(Snapshot_t));
+
+    __dmb();
+    after = lock->sequence;
+  } while((before & 1) || before != after);
+
+  return before;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string.h>
+
+#include <pico/stdlib.h>
+#include <hardware/sync.h>
+
+#include "devices-dcc50s.h"
+#include "devices-rvr40.h"
+#include "devices-lfp10s.h"
+#include "stats-history.h"
+
+// Consistent view of the device registers and rolling statistics, as rendered
+typedef struct {
+  uint16_t dcc50s[DCC50S_REG_END];
+  uint16_t rvr40[RVR40_REG_END];
+  uint16_t lfp100s[LFP100S_REG_END];
+  Statshot_t rolling;
+  uint64_t published_at;
+} Snapshot_t;
+
+/* Single producer seqlock around a Snapshot_t
+ *  The producer never waits, the sequence is odd while a publish is in progress.
+ *  Readers copy the snapshot out and retry if the sequence moved during the copy,
+ *  so neither side disables interrupts or blocks the other.
+ */
+typedef struct {
+  volatile uint32_t sequence;
+  Snapshot_t data;
+} SnapshotLock_t;
+
+void snapshot_publish(SnapshotLock_t* lock, const Snapshot_t* snapshot);
+uint32_t snapshot_read(const SnapshotLock_t* lock, Snapshot_t* snapshot);
@@ -0,0 +1,123 @@
+#include <string.h>
+#include "stats-history.h"
+
+inline static int32_t quantise(float value, float steps, int32_t min, int32_t max) {
+  int32_t q = (int32_t)(value * steps + (value < 0 ? -0.5f : 0.5f));
+
+  if(q < min)
+    return min;
+  if(q > max)
+    return max;
+
+  return q;
+}
+
+void stats_history_init(StatsHistory_t* history) {
+  memset(history, 0, sizeof(StatsHistory_t));
+}
+
+void stats_history_push(StatsHistory_t* history, const Statshot_t* stat) {
+  const uint16_t slot = history->head;
+
+  history->bat_soc[slot] = quantise(stat->bat_soc, STATS_SOC_PER_PERCENT, 0, 100 * STATS_SOC_PER_PERCENT);
+  history->bat_v[slot] = quantise(stat->bat_v, STATS_V_PER_VOLT, 0, UINT16_MAX);
+  history->load_w[slot] = quantise(stat->load_w, STATS_W_PER_WATT, INT16_MIN, INT16_MAX);
+  history->sol_w[slot] = stat->sol_w;
+  history->alt_w[slot] = stat->alt_w;
+  history->charged_ah[slot] = stat->charged_ah;
+  history->discharged_ah[slot] = stat->discharged_ah;
+
+  history->head = (slot + 1 >= STATS_MAX_HISTORY) ? 0 : slot + 1;
+  if(history->count < STATS_MAX_HISTORY)
+    history->count++;
+  history->total++;
+}
+
+int32_t stats_history_value(const StatsHistory_t* history, StatSeries_t series, uint16_t i) {
+  const uint16_t slot = stats_history_slot(history, i);
+
+  switch(series) {
+    case StatSoc:
+      return history->bat_soc[slot];
+    case StatBatteryVoltage:
+      return history->bat_v[slot];
+    case StatLoad:
+      return history->load_w[slot];
+    case StatSolar:
+      return history->sol_w[slot];
+    case StatAlternator:
+      return history->alt_w[slot];
+    case StatCharged:
+      return history->charged_ah[slot];
+    case StatDischarged:
+      return history->discharged_ah[slot];
+    default:
+      return 0;
+  }
+}
+
+// Copy a contiguous run of slots from one column (no wrap around)
+#define COPY_COLUMN(column, from, n, out) \
+  for(uint16_t c = 0; c < (n); c++) { \
+    (out)[c] = (column)[(from) + c]; \
+  }
+
+static void copy_slots(const StatsHistory_t* history, StatSeries_t series, uint16_t from, uint16_t n, int32_t* out) {
+  switch(series) {
+    case StatSoc:
+      COPY_COLUMN(history->bat_soc, from, n, out);
+      break;
+    case StatBatteryVoltage:
+      COPY_COLUMN(history->bat_v, from, n, out);
+      break;
+    case StatLoad:
+      COPY_COLUMN(history->load_w, from, n, out);
+      break;
+    case StatSolar:
+      COPY_COLUMN(history->sol_w, from, n, out);
+      break;
+    case StatAlternator:
+      COPY_COLUMN(history->alt_w, from, n, out);
+      break;
+    case StatCharged:
+      COPY_COLUMN(history->charged_ah, from, n, out);
+      break;
+    case StatDischarged:
+      COPY_COLUMN(history->discharged_ah, from, n, out);
+      break;
+    default:
+      memset(out, 0, n * sizeof(int32_t));
+      break;
+  }
+}
+
+// Copy samples [start, start + count) of a series in oldest to newest order, returns the amount copied
+uint16_t stats_history_copy(const StatsHistory_t* history, StatSeries_t series, uint16_t start, uint16_t count, int32_t* out) {
+  if(start >= history->count)
+    return 0;
+  if(count > history->count - start)
+    count = history->count - start;
+
+  // At most two linear runs, split where the ring wraps
+  const uint16_t slot = stats_history_slot(history, start);
+  const uint16_t first = (slot + count > STATS_MAX_HISTORY) ? STATS_MAX_HISTORY - slot : count;
+
+  copy_slots(history, series, slot, first, out);
+  copy_slots(history, series, 0, count - first, out + first);
+
+  return count;
+}
+
+// Units per raw quantised step of a series
+float stats_history_scale(StatSeries_t series) {
+  switch(series) {
+    case StatSoc:
+      return 1.f / STATS_SOC_PER_PERCENT;
+    case StatBatteryVoltage:
+      return 1.f / STATS_V_PER_VOLT;
+    case StatLoad:
+      return 1.f / STATS_W_PER_WATT;
+    default:
+      return 1.f;
+  }
+}
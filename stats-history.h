@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STATS_MAX_HISTORY         168
+
+// Quantisation steps of the stored history series
+#define STATS_SOC_PER_PERCENT     2     // 0.5 % steps
+#define STATS_V_PER_VOLT          100   // centivolts
+#define STATS_W_PER_WATT          10    // deciwatts (load only, signed)
+
+// Rolling (floating point) snapshot of the device readings
+typedef struct {
+  float bat_soc;
+  float bat_v;
+  float load_w;
+  uint16_t sol_w;
+  uint16_t alt_w;
+  uint16_t charged_ah;
+  uint16_t discharged_ah;
+} Statshot_t;
+
+typedef enum {
+  StatSoc,
+  StatBatteryVoltage,
+  StatLoad,
+  StatSolar,
+  StatAlternator,
+  StatCharged,
+  StatDischarged,
+  StatSeriesCount,
+} StatSeries_t;
+
+/* Historic snapshots, stored column wise (struct of arrays) as a ring buffer.
+ *  Each series is quantised to the smallest integer type fitting its range,
+ *  so a record is 13 bytes instead of the 24 bytes of a Statshot_t.
+ */
+typedef struct {
+  uint16_t head;                              // next slot to write
+  uint16_t count;                             // valid samples (<= STATS_MAX_HISTORY)
+  uint32_t total;                             // samples ever appended
+
+  uint8_t bat_soc[STATS_MAX_HISTORY];         // STATS_SOC_PER_PERCENT
+  uint16_t bat_v[STATS_MAX_HISTORY];          // STATS_V_PER_VOLT
+  int16_t load_w[STATS_MAX_HISTORY];          // STATS_W_PER_WATT
+  uint16_t sol_w[STATS_MAX_HISTORY];          // W
+  uint16_t alt_w[STATS_MAX_HISTORY];          // W
+  uint16_t charged_ah[STATS_MAX_HISTORY];     // Ah
+  uint16_t discharged_ah[STATS_MAX_HISTORY];  // Ah
+} StatsHistory_t;
+
+void stats_history_init(StatsHistory_t* history);
+void stats_history_push(StatsHistory_t* history, const Statshot_t* stat);
+
+// Ring slot of the i'th oldest sample (0 being the oldest retained sample)
+inline static uint16_t stats_history_slot(const StatsHistory_t* history, uint16_t i) {
+  uint16_t slot = history->head + STATS_MAX_HISTORY - history->count + i;
+  return slot >= STATS_MAX_HISTORY ? slot - STATS_MAX_HISTORY : slot;
+}
+
+int32_t stats_history_value(const StatsHistory_t* history, StatSeries_t series, uint16_t i);
+uint16_t stats_history_copy(const StatsHistory_t* history, StatSeries_t series, uint16_t start, uint16_t count, int32_t* out);
+float stats_history_scale(StatSeries_t series);
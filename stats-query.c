@@ -0,0 +1,172 @@
+#include <string.h>
+#include "stats-query.h"
+
+#define PREFIX_SIZE (STATS_MAX_HISTORY + 1)
+
+// Index of each series, StatsIndexCount when it is not indexed
+static const uint8_t stats_query_index[StatSeriesCount] = {
+  [StatSoc] = StatsIndexSoc,
+  [StatBatteryVoltage] = StatsIndexCount,
+  [StatLoad] = StatsIndexLoad,
+  [StatSolar] = StatsIndexSolar,
+  [StatAlternator] = StatsIndexAlternator,
+  [StatCharged] = StatsIndexCount,
+  [StatDischarged] = StatsIndexCount,
+};
+
+/* Min/max trees of one node type
+ *  Leaves are nodes [STATS_MAX_HISTORY, STATS_QUERY_NODES), node n covers nodes
+ *  2n and 2n + 1 and node 0 is unused. Unset nodes hold the identities (the
+ *  type's max in min, its min in max), so they never win a comparison.
+ */
+#define STATS_QUERY_TREE(name, type, type_min, type_max) \
+  static void name##_init(type* min, type* max) { \
+    for(uint16_t n = 0; n < STATS_QUERY_NODES; n++) { \
+      min[n] = type_max; \
+      max[n] = type_min; \
+    } \
+  } \
+  \
+  static void name##_set(type* min, type* max, uint16_t slot, type value) { \
+    uint16_t n = slot + STATS_MAX_HISTORY; \
+    \
+    min[n] = value; \
+    max[n] = value; \
+    \
+    for(n >>= 1; n > 0; n >>= 1) { \
+      const type l_min = min[n << 1], r_min = min[(n << 1) | 1]; \
+      const type l_max = max[n << 1], r_max = max[(n << 1) | 1]; \
+      \
+      min[n] = l_min < r_min ? l_min : r_min; \
+      max[n] = l_max > r_max ? l_max : r_max; \
+    } \
+  } \
+  \
+  /* min/max of ring slots [from, to), no wrap around */ \
+  static void name##_query(const type* min, const type* max, uint16_t from, uint16_t to, StatsAggregate_t* aggregate) { \
+    uint16_t l = from + STATS_MAX_HISTORY; \
+    uint16_t r = to + STATS_MAX_HISTORY; \
+    \
+    for(; l < r; l >>= 1, r >>= 1) { \
+      if(l & 1) { \
+        if(min[l] < aggregate->min) aggregate->min = min[l]; \
+        if(max[l] > aggregate->max) aggregate->max = max[l]; \
+        l++; \
+      } \
+      if(r & 1) { \
+        r--; \
+        if(min[r] < aggregate->min) aggregate->min = min[r]; \
+        if(max[r] > aggregate->max) aggregate->max = max[r]; \
+      } \
+    } \
+  }
+
+STATS_QUERY_TREE(tree_u8, uint8_t, 0, UINT8_MAX)
+STATS_QUERY_TREE(tree_i16, int16_t, INT16_MIN, INT16_MAX)
+STATS_QUERY_TREE(tree_u16, uint16_t, 0, UINT16_MAX)
+
+void stats_query_init(StatsQuery_t* query, const StatsHistory_t* history) {
+  memset(query->prefix, 0, sizeof(query->prefix));
+
+  tree_u8_init(query->soc_min, query->soc_max);
+  tree_i16_init(query->load_min, query->load_max);
+  tree_u16_init(query->solar_min, query->solar_max);
+  tree_u16_init(query->alternator_min, query->alternator_max);
+
+  query->history = history;
+}
+
+static void tree_set(StatsQuery_t* query, StatsIndex_t index, uint16_t slot, int32_t value) {
+  switch(index) {
+    case StatsIndexSoc:
+      tree_u8_set(query->soc_min, query->soc_max, slot, value);
+      break;
+    case StatsIndexLoad:
+      tree_i16_set(query->load_min, query->load_max, slot, value);
+      break;
+    case StatsIndexSolar:
+      tree_u16_set(query->solar_min, query->solar_max, slot, value);
+      break;
+    case StatsIndexAlternator:
+      tree_u16_set(query->alternator_min, query->alternator_max, slot, value);
+      break;
+    default:
+      break;
+  }
+}
+
+static void tree_query(const StatsQuery_t* query, StatsIndex_t index, uint16_t from, uint16_t to, StatsAggregate_t* aggregate) {
+  switch(index) {
+    case StatsIndexSoc:
+      tree_u8_query(query->soc_min, query->soc_max, from, to, aggregate);
+      break;
+    case StatsIndexLoad:
+      tree_i16_query(query->load_min, query->load_max, from, to, aggregate);
+      break;
+    case StatsIndexSolar:
+      tree_u16_query(query->solar_min, query->solar_max, from, to, aggregate);
+      break;
+    case StatsIndexAlternator:
+      tree_u16_query(query->alternator_min, query->alternator_max, from, to, aggregate);
+      break;
+    default:
+      break;
+  }
+}
+
+// Index the newest sample of the history
+void stats_query_append(StatsQuery_t* query) {
+  const StatsHistory_t* history = query->history;
+
+  if(history->count == 0)
+    return;
+
+  const uint16_t newest = history->count - 1;
+  const uint16_t slot = stats_history_slot(history, newest);
+  const uint16_t from = (history->total - 1) % PREFIX_SIZE;
+  const uint16_t to = history->total % PREFIX_SIZE;
+
+  for(uint16_t s = 0; s < StatSeriesCount; s++) {
+    const uint8_t index = stats_query_index[s];
+    if(index == StatsIndexCount)
+      continue;
+
+    const int32_t value = stats_history_value(history, s, newest);
+
+    query->prefix[index][to] = query->prefix[index][from] + (uint32_t)value;
+    tree_set(query, index, slot, value);
+  }
+}
+
+// Aggregate samples [t0, t1) of an indexed series, where 0 is the oldest retained sample
+bool stats_query_aggregate(const StatsQuery_t* query, StatSeries_t series, uint16_t t0, uint16_t t1, StatsAggregate_t* aggregate) {
+  const StatsHistory_t* history = query->history;
+
+  if(series >= StatSeriesCount || t1 > history->count || t0 >= t1)
+    return false;
+
+  const uint8_t index = stats_query_index[series];
+  if(index == StatsIndexCount)
+    return false;
+
+  const uint32_t first = history->total - history->count;
+  const uint32_t* prefix = query->prefix[index];
+
+  aggregate->count = t1 - t0;
+  aggregate->sum = (int32_t)(prefix[(first + t1) % PREFIX_SIZE] - prefix[(first + t0) % PREFIX_SIZE]);
+  aggregate->min = INT32_MAX;
+  aggregate->max = INT32_MIN;
+
+  // split the slot range where the ring wraps
+  const uint16_t from = stats_history_slot(history, t0);
+  const uint16_t length = t1 - t0;
+
+  if(from + length <= STATS_MAX_HISTORY) {
+    tree_query(query, index, from, from + length, aggregate);
+  } else {
+    tree_query(query, index, from, STATS_MAX_HISTORY, aggregate);
+    tree_query(query, index, 0, from + length - STATS_MAX_HISTORY, aggregate);
+  }
+
+  return true;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "stats-history.h"
+
+// Nodes of an iterative (bottom up) segment tree, one leaf per ring slot
+#define STATS_QUERY_NODES   (STATS_MAX_HISTORY * 2)
+
+typedef struct {
+  uint16_t count;
+  int32_t sum;
+  int32_t min;
+  int32_t max;
+} StatsAggregate_t;
+
+// The series indexed, those the statistics chart queries
+typedef enum {
+  StatsIndexSoc,
+  StatsIndexLoad,
+  StatsIndexSolar,
+  StatsIndexAlternator,
+  StatsIndexCount,
+} StatsIndex_t;
+
+/* Range query index over a StatsHistory_t
+ *  Prefix sums answer window sums (and so means) in O(1), and a segment tree per
+ *  series answers window min/max in O(log n). Both are keyed by ring slot, and
+ *  updated in O(log n) by stats_query_append() after each stats_history_push().
+ *  Only the StatsIndex_t series are indexed, each tree at its column's own width.
+ */
+typedef struct {
+  const StatsHistory_t* history;
+
+  // prefix[i][n % (STATS_MAX_HISTORY + 1)] is the (wrapping) sum of samples [0, n)
+  uint32_t prefix[StatsIndexCount][STATS_MAX_HISTORY + 1];
+  uint8_t soc_min[STATS_QUERY_NODES];
+  uint8_t soc_max[STATS_QUERY_NODES];
+  int16_t load_min[STATS_QUERY_NODES];
+  int16_t load_max[STATS_QUERY_NODES];
+  uint16_t solar_min[STATS_QUERY_NODES];
+  uint16_t solar_max[STATS_QUERY_NODES];
+  uint16_t alternator_min[STATS_QUERY_NODES];
+  uint16_t alternator_max[STATS_QUERY_NODES];
+} StatsQuery_t;
+
+void stats_query_init(StatsQuery_t* query, const StatsHistory_t* history);
+void stats_query_append(StatsQuery_t* query);
+bool stats_query_aggregate(const StatsQuery_t* query, StatSeries_t series, uint16_t t0, uint16_t t1, StatsAggregate_t* aggregate);
+
+inline static int32_t stats_aggregate_mean(const StatsAggregate_t* aggregate) {
+  return aggregate->count == 0 ? 0 : aggregate->sum / aggregate->count;
+}
@@ -4,412 +4,155 @@
 // Interface State
 static PageContents_t current_page;
 static uint64_t btn_last_pressed;
+static uint64_t page_requested_at;
 static uint64_t time_since_boot;
+static Snapshot_t view;
 
 // Statistics State
-static uint16_t stats_count;
-static Statshot_t stats_data[STATS_MAX_HISTORY];
-static Statshot_t* stats_head = (Statshot_t*)&stats_data;
+static StatsHistory_t stats_history;
+static StatsQuery_t stats_query;
 static uint16_t stats_rolling_count;
 static Statshot_t stats_rolling;
-static struct repeating_timer timer_stats_historic;
-static struct repeating_timer timer_stats_rolling;
+static SchedulerTask_t* task_stats_historic;
+static SchedulerTask_t* task_stats_rolling;
 
 // EPD State
-static uint8_t display_buffer_black[SCREEN_W * SCREEN_H];
-static uint8_t display_buffer_red[SCREEN_W * SCREEN_H];
-static bool display_state;
+#ifdef EPD_RENDER_BANDED
+static DisplayList_t page_list;
+#else
+static PageCache_t page_cache[PageContentsCount];
+static SchedulerTask_t* task_render_pages;
+#endif
+static uint32_t page_switch_latency_us;       // press to the start of the transfer
+static uint32_t page_switch_latency_max_us;
+static uint32_t display_fingerprint;
+static uint32_t display_refreshes_performed;
+static uint32_t display_refreshes_skipped;
 #ifdef EPD_UPDATE_PARTIAL
-static uint8_t display_refresh_count;
+static uint8_t display_sent_black[SCREEN_W * SCREEN_H];
+static uint8_t display_sent_red[SCREEN_W * SCREEN_H];
+static bool display_synced;
 static bool display_partial_mode;
 #endif
 
-// Device State
-static uint16_t dcc50s_registers[DCC50S_REG_END];
-static uint16_t rvr40_registers[RVR40_REG_END];
-static uint16_t lfp100s_registers[LFP100S_REG_END];
-
-float battery_max_capacity() {
-  uint16_t reg1 = lfp100s_registers[LFP100S_REG_MAX_CAPACITY_1];
-  uint16_t reg2 = lfp100s_registers[LFP100S_REG_MAX_CAPACITY_2];
-  float battery_max_capacity = ((reg1 << 15) | (reg2 >> 1));
-
-  return battery_max_capacity * 0.002f;
-}
-
-float battery_capacity() {
-  uint16_t reg1 = lfp100s_registers[LFP100S_REG_CAPACITY_1];
-  uint16_t reg2 = lfp100s_registers[LFP100S_REG_CAPACITY_2];
-  uint16_t capacity = ((reg1 << 15) | (reg2 >> 1));
-
-  return capacity * 0.002f;
-}
-
-float battery_percentage() {
-  float max = battery_max_capacity();
-  float cap = battery_capacity();
-  float percent = (cap / max) * 100.0;
-
-  return percent;
-}
-
-float battery_amperes() {
-  uint16_t amps = lfp100s_registers[LFP100S_REG_LOAD_A];
-
-  if(amps < 61440)
-    return (float)amps / 100.0;
-  else
-    return (float)(amps - 65535) / 100.0;
-}
-
-float battery_voltage() {
-  uint16_t v = lfp100s_registers[LFP100S_REG_VOLTAGE];
-  return (float)v / 10.f;
-}
-
-float battery_load_watts() {
-  float a = battery_amperes();
-  float v = battery_voltage();
-  return a * v;
-}
-
-float solar_voltage() {
-  uint16_t v = rvr40_registers[RVR40_REG_SOLAR_V];
-  return (float)v / 10.f;
-}
-
-float solar_amperage() {
-  uint16_t a = rvr40_registers[RVR40_REG_SOLAR_A];
-  return (float)a / 100.f;
-}
-
-void calculate_temperatures(uint16_t state, uint16_t* internal, uint16_t* aux) {
-  *internal = (state >> 8);
-  *aux = (state & 0xff);
-}
-
-void get_charge_status(char* buffer) {
-  float load_amps = battery_amperes();
-
-  if(load_amps > 0) {
-    sprintf(buffer, "Charging");
-  } else {
-    sprintf(buffer, "Discharging");
-  }
-}
-
-void update_page_overview() {
-  char line[32];
-
-  uint16_t alt_w = dcc50s_registers[DCC50S_REG_ALT_W];
-  uint16_t sol_w = rvr40_registers[RVR40_REG_SOLAR_W];
-
-  float bat_soc = battery_percentage();
-  float bat_v = battery_voltage();
-
-  // Draw the main battery state
-  get_charge_status((char*)&line);
-  display_draw_title(line, 5, 12, Black);
-
-  // Battery SOC% and voltage
-  sprintf((char*)&line, "%.0f%%", bat_soc);
-  display_draw_title(line, DISPLAY_H / 2 - 5, DISPLAY_W / 3 + 3, Black);
-  sprintf((char*)&line, "%.2fV", bat_v);
-  display_draw_text(line, DISPLAY_H / 2, DISPLAY_W / 3 + 30, Black);
-
-  display_draw_text("Alternator", 10, 50, Black);
-  sprintf((char*)&line, "%dW", alt_w);
-  display_draw_text(line, 100, 50, Black);
-
-  display_draw_text("Solar", 10, 70, Black);
-  sprintf((char*)&line, "%dW", sol_w);
-  display_draw_text(line, 100, 70, Black);
-}
-
-void update_page_solar() {
-  char line[32];
-
-  float sol_v = solar_voltage();
-  float sol_a = solar_amperage();
-  uint16_t sol_w = rvr40_registers[RVR40_REG_SOLAR_W];
-  uint16_t temperature_ctrl, temperature_aux;
-
-  display_draw_title("Solar", 5, 12, Black);
-
-  sprintf((char*)&line, "+ %.*fA", 1, sol_a);
-  display_draw_text(line, 5, 50, Black);
-
-  sprintf((char*)&line, "%.*fV", 1, sol_v);
-  display_draw_text(line, 50, 50, Black);
-
-  sprintf((char*)&line, "%dW", sol_w);
-  display_draw_title(line, 100, 50, Black);
+// Device State (latest round from core 1, rendered through snapshot)
+static AcquisitionSample_t sample;
+static SnapshotLock_t snapshot;
 
-  display_draw_text("Daily Stats", DISPLAY_H / 2 + 15, 30, Black);
-  display_draw_text("Charged", DISPLAY_H / 2 + 25, 45, Black);
-  display_draw_text("Discharged", DISPLAY_H / 2 + 25, 60, Black);
+#ifndef EPD_RENDER_BANDED
+void page_cache_init() {
+  for(uint8_t p = 0; p < PageContentsCount; p++) {
+    PageCache_t* page = &page_cache[p];
 
-  sprintf((char*)&line, "%dAh",
-      rvr40_registers[RVR40_REG_DAY_CHG_AMPHRS]);
-  display_draw_text(line, DISPLAY_H - 35, 45, Black);
-
-  sprintf((char*)&line, "%dAh",
-      rvr40_registers[RVR40_REG_DAY_DCHG_AMPHRS]);
-  display_draw_text(line, DISPLAY_H - 35, 60, Black);
-
-  display_draw_text("Temperatures (C)", DISPLAY_H / 2 + 15, 80, Black);
-  calculate_temperatures(rvr40_registers[RVR40_REG_TEMPERATURE], &temperature_ctrl, &temperature_aux);
-  sprintf((char*)&line, "RVR: %d, Bat: %d", temperature_ctrl, temperature_aux);
-  display_draw_text(line, DISPLAY_H / 2 + 25, 95, Black);
-}
-
-void update_page_alternator() {
-  char line[32];
-
-  uint16_t alt_a = dcc50s_registers[DCC50S_REG_ALT_A];
-  uint16_t alt_v = dcc50s_registers[DCC50S_REG_ALT_V];
-  uint16_t alt_w = dcc50s_registers[DCC50S_REG_ALT_W];
-  uint16_t day_total_ah = dcc50s_registers[DCC50S_REG_DAY_TOTAL_AH];
-  uint16_t temperatures = dcc50s_registers[RVR40_REG_TEMPERATURE];
-  uint16_t temperature_ctrl, temperature_aux;
-
-  display_draw_title("Alternator", 5, 12, Black);
-  display_draw_text("Charge Status", DISPLAY_H / 2 + 20, 30, Black);
-
-  sprintf((char*)&line, "%dA", alt_a);
-  display_draw_text(line, DISPLAY_H / 2 + 20, 53, Black);
-
-  sprintf((char*)&line, "%dV", alt_v);
-  display_draw_text(line, DISPLAY_H / 2 + 40, 53, Black);
-
-  sprintf((char*)&line, "%dW", alt_w);
-  display_draw_title(line, DISPLAY_H / 2 + 80, 50, Black);
-
-  sprintf((char*)&line, "%dAh today", day_total_ah);
-  display_draw_text(line, DISPLAY_H / 2 + 25, 65, Black);
-
-  display_draw_text("Temperatures (C)", 10, 40, Black);
-  calculate_temperatures(temperatures, &temperature_ctrl, &temperature_aux);
-  sprintf((char*)&line, "DCC: %d, Bat: %d", temperature_ctrl, temperature_aux);
-  display_draw_text(line, 20, 55, Black);
-}
-
-void update_menu() {
-  const uint16_t size = MENU_IMAGE_SIZE;
-  const uint16_t menu_y = DISPLAY_W - MENU_IMAGE_SIZE;
-
-  display_draw_xbitmap(0, menu_y, size, size, menu_home_bits);
-  display_draw_xbitmap(size, menu_y, size, size, menu_solar_bits);
-  display_draw_xbitmap(size * 2, menu_y, size, size, menu_alternator_bits);
-  display_draw_xbitmap(size * 3, menu_y, size, size, menu_stats_bits);
-
-  switch(current_page) {
-    case Overview:
-      display_draw_rect(0, menu_y, size, DISPLAY_W - 1);
-      break;
-    case Solar:
-      display_draw_rect(size, menu_y, size * 2, DISPLAY_W - 1);
-      break;
-    case Alternator:
-      display_draw_rect(size * 2, menu_y, size * 3, DISPLAY_W - 1);
-      break;
-    case Statistics:
-      display_draw_rect(size * 3, menu_y, size * 4, DISPLAY_W - 1);
-      break;
+    canvas_init(&page->canvas, page->black, page->red, 0, SCREEN_H);
+#ifdef EPD_UPDATE_PARTIAL
+    // every page is diffed against the one copy of what the panel shows
+    page->canvas.sent_black = display_sent_black;
+    page->canvas.sent_red = display_sent_red;
+#endif
+    page->stale = true;
   }
 }
 
-void update_page_overview_battery() {
-  const uint16_t third_x = DISPLAY_H / 3;
-  const uint16_t third_y = DISPLAY_W / 3;
-  char line[32];
-
-  float percent = battery_percentage();
-  float capacity = battery_capacity();
-  float unit_percent = percent / 100.0;
-  uint16_t battery_width = (uint16_t)(((DISPLAY_H - 20) - (third_x * 2 - 4)) * unit_percent);
-
-  // Draw battery outline and contents
-  display_draw_rect(third_x * 2, third_y, DISPLAY_H - 20, third_y * 2);
-  if(percent > 25.0) {
-    display_set_buffer(display_buffer_black);
-  } else {
-    display_set_buffer(display_buffer_red);
-  }
-  display_draw_fill(third_x * 2 + 2, third_y + 2, third_x * 2 + battery_width, third_y * 2 - 1);
-
-  // Use rolling average load in watts over the last STATS_UPDATE_ROLLING_MS period
-  // Can use battery_load_watts() for current point in time of update
-  float load_w = stats_rolling.load_w;
-  if(load_w > 0)
-    sprintf((char*)&line, "+%.2fW", load_w);
-  else
-    sprintf((char*)&line, "%.2fW", load_w);
-  display_set_buffer(display_buffer_black);
-  display_draw_text(line, third_x * 2, third_y - 20, Black);
-
-  // Determine time until discharged or full
-  if(load_w != 0) {
-    if(load_w < 0) {
-      float hrs_left = 10.0 * capacity / -load_w;
-      if(hrs_left != INFINITY) {
-        if(hrs_left < 24) {
-          sprintf((char*)&line, "empty %.2fh", hrs_left);
-        } else {
-          sprintf((char*)&line, "empty %.2fd", hrs_left / 24.0);
-        }
-        if(hrs_left < 12) {
-          display_set_buffer(display_buffer_red);
-          display_draw_text(line, third_x * 2, third_y * 2 + 10, Red);
-        } else {
-          display_set_buffer(display_buffer_black);
-          display_draw_text(line, third_x * 2, third_y * 2 + 10, Black);
-        }
-      }
-    } else {
-      float hrs_full = 10.0 * capacity / load_w;
-
-      if(hrs_full != INFINITY && hrs_full != 0) {
-        if(hrs_full < 24) {
-          sprintf((char*)&line, "full %.2fh", hrs_full);
-        } else {
-          sprintf((char*)&line, "full %.2fd", hrs_full / 24.0);
-        }
-        display_set_buffer(display_buffer_black);
-        display_draw_text(line, third_x * 2, third_y * 2 + 10, Black);
-      }
-    }
+void page_cache_invalidate() {
+  for(uint8_t p = 0; p < PageContentsCount; p++) {
+    page_cache[p].stale = true;
   }
+  scheduler_post(task_render_pages);
 }
 
-inline static bool should_draw_stat_in_days() {
-  return (stats_count >= 48);
-}
+// Render a page into its cache
+void render_page(PageContents_t p) {
+  PageCache_t* page = &page_cache[p];
 
-void draw_stat(uint16_t i, uint16_t plot_x_start, uint16_t plot_x_iter, uint16_t plot_height) {
-  char line[3];
-  uint16_t value = plot_height - ((float)stats_data[i].bat_soc / 100.f) * plot_height;
-  uint16_t x = plot_x_start + plot_x_iter * i;
+  // Render from a consistent copy of the latest published data
+  snapshot_read(&snapshot, &view);
+  display_set_canvas(&page->canvas);
 
-  if(i > 0) {
-    uint16_t last_value = plot_height - ((float)stats_data[i - 1].bat_soc / 100.f) * plot_height;
+  // Start from the static layer, drawing it on first use
+  if(!page->static_ready) {
+    display_fill_colour(White);
+    update_page_static(p);
 
-    display_set_buffer(display_buffer_black);
-    display_draw_line(x - plot_x_iter, last_value, x, value);
+    memcpy(page->static_black, page->black, CANVAS_SIZE);
+    memcpy(page->static_red, page->red, CANVAS_SIZE);
+    page->static_ready = true;
+  } else {
+    memcpy(page->black, page->static_black, CANVAS_SIZE);
+    memcpy(page->red, page->static_red, CANVAS_SIZE);
   }
 
-  if(should_draw_stat_in_days()) {
-    if((stats_count - i) % 24 == 0) {
-      uint16_t avg, sum;
-      for(uint16_t v = i - 24; v < i; v++) {
-        sum += stats_data[v].bat_soc;
-      }
-      avg = plot_height - ((float)sum / 24.f) * plot_height;
+  update_page_contents(p, &view, &stats_query);
 
-      display_set_buffer(display_buffer_red);
-      display_draw_fill(x - 1, avg - 1, x + 2, avg + 2);
-
-      sprintf((char*)line, "%d", (stats_count - i) / 24);
-      display_set_buffer(display_buffer_black);
-      display_draw_text(line, x, plot_height + 7, Black);
-    }
-  } else {
-    display_set_buffer(display_buffer_red);
-    display_draw_fill(x - 1, value - 1, x + 2, value + 2);
-
-    if(stats_count < 12 || (stats_count - i) % 5 == 0) {
-      sprintf((char*)line, "%d", (stats_count - i));
-      display_set_buffer(display_buffer_black);
-      display_draw_text(line, x - 5, plot_height + 7, Black);
-    }
-  }
+  page->fingerprint = canvas_fingerprint(&page->canvas);
+  page->stale = false;
 }
+#endif
 
-void update_page_statistics() {
-  const uint16_t plot_x_start = 25;
-  const uint16_t plot_x_iter = stats_count == 0 ? 1 : (DISPLAY_H - plot_x_start) / stats_count;
-  const uint16_t plot_height = DISPLAY_W - MENU_IMAGE_SIZE - 25;
-
-  uint16_t join_index;
+// Show the current page, returns false when the panel was left untouched
+bool update_page() {
+#ifdef EPD_RENDER_BANDED
+  // Record the page, it is only rendered (a band at a time) as it is sent
+  snapshot_read(&snapshot, &view);
+  display_set_list(&page_list);
+  display_fill_colour(White);
+  update_page_static(current_page);
+  update_page_contents(current_page, &view, &stats_query);
+  display_set_list(NULL);
 
-  // Draw chart with axis
-  display_draw_rect(plot_x_start, 0, DISPLAY_H - 1, plot_height);
-  display_draw_text("0", 5, plot_height - 5, Black);
-  display_draw_text("%", 5, plot_height / 2, Black);
-  display_draw_text("100", 0, 0, Black);
+  const uint32_t fingerprint = display_list_fingerprint(&page_list);
+#else
+  PageCache_t* page = &page_cache[current_page];
 
-  // Determine if we are rendering days or hours
-  if(should_draw_stat_in_days()) {
-    display_draw_title("Daily", DISPLAY_H - 80, DISPLAY_W - 20, Black);
-  } else {
-    display_draw_title("Hourly", DISPLAY_H - 96, DISPLAY_W - 20, Black);
+  // the background render has not caught up yet (or was never run)
+  if(page->stale) {
+    render_page(current_page);
   }
+  const uint32_t fingerprint = page->fingerprint;
+#endif
 
-  // iterate to find where beginning meets end (ring buffer)
-  for(uint16_t i = 0; i < stats_count; i++) {
-    if(stats_data[i].index == 0) {
-      join_index = i;
-      break;
-    }
-  }
-  // draw from beginning to end of the buffer (regardless of starting index)
-  for(uint16_t i = 0; i < join_index; i++) {
-    draw_stat(i, plot_x_start, plot_x_iter, plot_height);
-  }
-  for(uint16_t i = join_index; i < stats_count; i++) {
-    draw_stat(i, plot_x_start, plot_x_iter, plot_height);
+  // Leave the panel asleep when nothing visible changed since the last refresh
+  if(display_refreshes_performed > 0 && fingerprint == display_fingerprint) {
+    display_refreshes_skipped++;
+#ifdef _VERBOSE
+    printf("Frame unchanged, skipped refresh (%lu skipped, %lu performed)\n",
+        display_refreshes_skipped, display_refreshes_performed);
+#endif
+    return false;
   }
-}
-
-void update_page() {
-  // Clear black and red buffers (with White, 0xff);
-  display_set_buffer(display_buffer_red);
-  display_fill_colour(White);
-  display_set_buffer(display_buffer_black);
-  display_fill_colour(White);
 
 #ifdef EPD_UPDATE_PARTIAL
-  // full refresh after x partials or first draw
-  if(display_refresh_count == 0 || display_refresh_count >= EPD_FULL_REFRESH_AFTER) {
+  CanvasRect_t damage[CANVAS_MAX_DAMAGE];
+  uint8_t damaged = canvas_damage(&page->canvas, damage, CANVAS_MAX_DAMAGE);
+
+  // full refresh on first draw, or once a damaged region has had EPD_FULL_REFRESH_AFTER partials
+  display_partial_mode = display_synced
+    && display_partial_allowed(damage, damaged, EPD_FULL_REFRESH_AFTER);
+  if(display_partial_mode && damaged == 0) {
+    display_refreshes_skipped++;
+    return false;
+  }
 #ifdef _VERBOSE
+  if(!display_partial_mode) {
     printf("Full refresh \n");
-#endif
-    display_partial_mode = false;
-    display_refresh_count = 1;
-  } else {
-    display_partial_mode = true;
-    display_refresh_count++;
   }
+#endif
 #endif
 
-  update_menu();
-
-  switch(current_page) {
-    case Overview:
-      update_page_overview();
-      update_page_overview_battery();
-      break;
-
-    case Alternator:
-      update_page_alternator();
-      break;
-
-    case Solar:
-      update_page_solar();
-      break;
-
-    case Statistics:
-      update_page_statistics();
-      break;
+  display_fingerprint = fingerprint;
+  display_refreshes_performed++;
 
-    default:
-      display_draw_title("404", 5, 12, Black);
-      break;
-  }
+  display_power_up();
 
-  if(!display_state){
-    display_wake();
-    display_state = true;
+  if(page_requested_at != 0) {
+    page_switch_latency_us = time_us_64() - page_requested_at;
+    if(page_switch_latency_us > page_switch_latency_max_us)
+      page_switch_latency_max_us = page_switch_latency_us;
+    page_requested_at = 0;
+#ifdef _VERBOSE
+    printf("Page change transfer started %luus after the press (max %luus)\n",
+        page_switch_latency_us, page_switch_latency_max_us);
+#endif
   }
 
 #ifdef EPD_UPDATE_PARTIAL
@@ -419,26 +162,28 @@ void update_page() {
 #ifdef _VERBOSE
     printf("Updating full screen normal refresh\n");
 #endif
-    display_send_buffer(display_buffer_black, SCREEN_W, SCREEN_H, 1);
-    display_send_buffer(display_buffer_red, SCREEN_W, SCREEN_H, 2);
-    busy_wait_ms(20);
-#ifdef EPD_UPDATE_PARTIAL
-    display_refresh(true);
+#ifdef EPD_RENDER_BANDED
+    display_draw_list(&page_list);
 #else
-    display_refresh(false);
+    display_send_buffer(page->black, SCREEN_W, SCREEN_H, 1);
+    display_send_buffer(page->red, SCREEN_W, SCREEN_H, 2);
 #endif
-    busy_wait_ms(200);
-    display_sleep();
-    display_state = false;
+    busy_wait_ms(20);
+    display_refresh(true);
 
 #ifdef EPD_UPDATE_PARTIAL
+    display_partial_reset();
+    canvas_mark_sent(&page->canvas);
+    display_synced = true;
     busy_wait_ms(1000);
   } else {
-    printf("Updating partial\n");
-    const coord_t screen_region = { 0, 0, DISPLAY_W - 1, DISPLAY_H - 1 };
-    display_draw_partial(display_buffer_black, display_buffer_red, screen_region);
+    printf("Updating %d partial regions\n", damaged);
+    display_draw_partial(page->black, page->red, damage, damaged);
+    canvas_mark_sent(&page->canvas);
   }
 #endif
+
+  return true;
 }
 
 void btn_handler(uint gpio, uint32_t events) {
@@ -448,8 +193,8 @@ void btn_handler(uint gpio, uint32_t events) {
   if (events & 0x8) { // Rise
     if(time_us_64() > btn_last_pressed + 350000) // 350ms
     {
-      current_page = (++current_page) % PageContentsCount;
-      printf("Changed current page to %d\n", current_page);
+      // the page is changed by the main loop, which may be mid refresh
+      events_post(EventButton);
       btn_last_pressed = time_us_64();
     }
   }
@@ -476,28 +221,19 @@ inline static uint16_t update_rolling_statistic(uint16_t* avg, uint16_t new_valu
 
 Statshot_t get_latest_stats() {
   Statshot_t latest = {
-    stats_rolling_count + 1,
-    battery_percentage(),
-    battery_voltage(),
-    battery_load_watts(),
-    dcc50s_registers[DCC50S_REG_ALT_W],
-    rvr40_registers[RVR40_REG_SOLAR_W],
-    dcc50s_registers[DCC50S_REG_DAY_TOTAL_AH] + rvr40_registers[RVR40_REG_DAY_CHG_AMPHRS],
-    rvr40_registers[RVR40_REG_DAY_DCHG_AMPHRS]
+    .bat_soc = battery_percentage(sample.lfp100s),
+    .bat_v = battery_voltage(sample.lfp100s),
+    .load_w = battery_load_watts(sample.lfp100s),
+    .sol_w = sample.rvr40[RVR40_REG_SOLAR_W],
+    .alt_w = sample.dcc50s[DCC50S_REG_ALT_W],
+    .charged_ah = sample.dcc50s[DCC50S_REG_DAY_TOTAL_AH] + sample.rvr40[RVR40_REG_DAY_CHG_AMPHRS],
+    .discharged_ah = sample.rvr40[RVR40_REG_DAY_DCHG_AMPHRS],
   };
   return latest;
 }
 
 void reset_statistics(Statshot_t* stat) {
-  Statshot_t latest = get_latest_stats();
-
-  stat->bat_soc = latest.bat_soc;
-  stat->bat_v = latest.bat_v;
-  stat->load_w = latest.load_w;
-  stat->alt_w = latest.alt_w;
-  stat->sol_w = latest.sol_w;
-  stat->charged_ah = latest.charged_ah;
-  stat->discharged_ah = latest.discharged_ah;
+  *stat = get_latest_stats();
 }
 
 void update_rolling_statistic_from_latest() {
@@ -508,7 +244,7 @@ void update_rolling_statistic_from_latest() {
     reset_statistics(&stats_rolling);
   }
 #ifdef _VERBOSE
-  printf("Updating rolling with latest %f percent\n", latest.bat_soc);
+  printf("Updating rolling with latest %ld%%\n", (long)(latest.bat_soc + 0.5f));
 #endif
 
   // Update using rolling average values
@@ -523,12 +259,28 @@ void update_rolling_statistic_from_latest() {
   // Increment rolling average count
   stats_rolling_count++;
 #ifdef _VERBOSE
-  printf("Rolling is now %f percent, load: %f\n", stats_rolling.bat_soc, stats_rolling.load_w);
-  printf("Head is now %f percent, load: %f\n", stats_head->bat_soc, stats_head->load_w);
-  printf("Stats rolling count: %d, stats count: %d\n", stats_rolling_count, stats_count);
+  char load[16];
+  Format_t text;
+  format_init(&text, load, sizeof(load));
+  format_fixed(&text, to_centi(stats_rolling.load_w), 2, 2, UnitWatts);
+  printf("Rolling is now %ld%%, load: %s\n", (long)(stats_rolling.bat_soc + 0.5f), load);
+  printf("Stats rolling count: %d, stats count: %d\n", stats_rolling_count, stats_history.count);
 #endif
 }
 
+void publish_snapshot() {
+  Snapshot_t latest;
+
+  memcpy(latest.dcc50s, sample.dcc50s, sizeof(sample.dcc50s));
+  memcpy(latest.rvr40, sample.rvr40, sizeof(sample.rvr40));
+  memcpy(latest.lfp100s, sample.lfp100s, sizeof(sample.lfp100s));
+  latest.rolling = stats_rolling;
+  latest.published_at = time_us_64();
+
+  snapshot_publish(&snapshot, &latest);
+  events_post(EventData);
+}
+
 void update_historical_statistics() {
   // Idealy should not happen, unless the update timings are not adequate
   //  STATS_UPDATE_ROLLING_MS should be less than STATS_UPDATE_HISTORIC_MS
@@ -537,94 +289,95 @@ void update_historical_statistics() {
     update_rolling_statistic_from_latest();
   }
 
-  // update latest stats with rolling total before incrementing to the next historic snapshot
-  stats_head->bat_soc = stats_rolling.bat_soc;
-  stats_head->bat_v = stats_rolling.bat_v;
-  stats_head->load_w = stats_rolling.load_w;
-  stats_head->alt_w = stats_rolling.alt_w;
-  stats_head->sol_w = stats_rolling.sol_w;
-  stats_head->charged_ah = stats_rolling.charged_ah;
-  stats_head->discharged_ah = stats_rolling.discharged_ah;
-
-  // lazy mans ring buffer
-  if(stats_count < STATS_MAX_HISTORY - 1) {
-    stats_head++;
-    stats_count++;
-    stats_head->index = stats_count;
-  } else {
-    // reset to head
-    if(stats_head->index >= STATS_MAX_HISTORY-1) {
-      stats_head = (Statshot_t*)&stats_data;
-      stats_head->index = 0;
-    }
-    else {
-      uint8_t last_index = stats_head->index;
-      stats_head++;
-      stats_head->index = last_index + 1;
-    }
-  }
+  // store the rolling averages as the next historic snapshot
+  stats_history_push(&stats_history, &stats_rolling);
+  stats_query_append(&stats_query);
 
-  // Fill using the latest value
-  if(stats_count == 0) {
-    reset_statistics(stats_head);
-  } else {
-    // Reset rolling averages for the next historical period
-    reset_statistics(&stats_rolling);
-    stats_rolling_count = 1;
-  }
+  // Reset rolling averages for the next historical period
+  reset_statistics(&stats_rolling);
+  stats_rolling_count = 1;
+  publish_snapshot();
 }
 
-bool alarm_update_historic_statistics_callback(struct repeating_timer* t) {
+void task_update_historic_statistics() {
 #ifdef _VERBOSE
-  printf("ALARM: Historic Statistics timer fired!\n");
+  printf("TASK: Historic Statistics released!\n");
 #endif
   update_historical_statistics();
 
-  return true;
+#ifdef _VERBOSE
+  scheduler_print_stats();
+  printf("Display refreshes performed: %lu, skipped: %lu\n",
+      display_refreshes_performed, display_refreshes_skipped);
+  refresh_governor_print_stats();
+  printf("Events dropped: %lu\n", events_dropped());
+  display_power_print_stats();
+#endif
 }
 
-void retreive_data_and_update_rolling() {
-  int state;
+void task_update_rolling_statistics() {
+#ifdef _VERBOSE
+  printf("TASK: Rolling Statistics released!\n");
+#endif
 
-  state = devices_modbus_read_registers(
-      RS232_PORT, RS232_RVR40_ADDRESS, RVR40_REG_START, RVR40_REG_END, (uint16_t*)&rvr40_registers);
-  if(state != 3) {
-    printf("RS232 (RVR40) failed to read registers, returned: %d\n", state);
+  // update rolling statistics with every round received from core 1
+  while(acquisition_pop(&sample)) {
+    update_rolling_statistic_from_latest();
   }
-
-  state = devices_modbus_read_registers(
-     RS485_PORT, RS485_LFP100S_ADDRESS, LFP100S_REG_START, LFP100S_REG_END, (uint16_t*)&lfp100s_registers);
-  if(state != 3) {
-    printf("RS485 (LFP100S) failed to read registers, returned: %d\n", state);
+#ifdef _VERBOSE
+  for(uint8_t d = 0; d < DeviceCount; d++) {
+    printf("Device %d: %lu polls, %lu failures (%d consecutive)\n", d,
+        sample.health[d].polls, sample.health[d].failures, sample.health[d].consecutive_failures);
   }
+#endif
 
-  state = devices_modbus_read_registers(
-    RS485_PORT, RS485_DCC50S_ADDRESS, DCC50S_REG_START, DCC50S_REG_END, (uint16_t*)&dcc50s_registers);
-  if(state != 3) {
-    printf("RS485 (DCC50S) failed to read registers, returned: %d\n", state);
+  publish_snapshot();
+}
+
+#ifndef EPD_RENDER_BANDED
+// Render the stale pages one per run, the current page first, so button presses are not held up
+void task_render_page_cache() {
+  PageContents_t p = current_page;
+
+  if(!page_cache[p].stale) {
+    for(p = 0; p < PageContentsCount && !page_cache[p].stale; p++);
+    if(p == PageContentsCount)
+      return;
   }
+  render_page(p);
 
-  // update rolling statistics based on latest data received
-  update_rolling_statistic_from_latest();
+  for(uint8_t i = 0; i < PageContentsCount; i++) {
+    if(page_cache[i].stale) {
+      scheduler_post(task_render_pages);
+      break;
+    }
+  }
 }
-
-bool alarm_update_rolling_statistics_callback(struct repeating_timer* t) {
-#ifdef _VERBOSE
-  printf("ALARM: Rolling Statistics timer fired!\n");
 #endif
-  retreive_data_and_update_rolling();
 
-  return true;
+// Called from core 1 after each acquisition round
+//  the scheduler is core 0 only, so the release goes through the (multicore safe) events queue
+void on_acquisition_sample() {
+  events_post(EventSample);
 }
 
-int alarms_initialise() {
-  printf("Intialising alarms... ");
-  if(!add_repeating_timer_ms(STATS_UPDATE_HISTORIC_MS, alarm_update_historic_statistics_callback, NULL, &timer_stats_historic)){
-    printf("Unable to initialise historic statistics timer\n");
+// Timers (and core 1, through EventSample) only release the tasks, statistics run from the main loop
+int tasks_initialise() {
+  printf("Intialising tasks... ");
+  task_stats_historic = scheduler_add("historic", task_update_historic_statistics, TASK_HISTORIC_DEADLINE_MS);
+  task_stats_rolling = scheduler_add("rolling", task_update_rolling_statistics, TASK_ROLLING_DEADLINE_MS);
+  if(task_stats_historic == NULL || task_stats_rolling == NULL) {
     return -1;
   }
-  if(!add_repeating_timer_ms(STATS_UPDATE_ROLLING_MS, alarm_update_rolling_statistics_callback, NULL, &timer_stats_rolling)){
-    printf("Unable to initialise rolling statistics timer\n");
+#ifndef EPD_RENDER_BANDED
+  task_render_pages = scheduler_add("pages", task_render_page_cache, TASK_PAGES_DEADLINE_MS);
+  if(task_render_pages == NULL) {
+    return -1;
+  }
+#endif
+
+  if(scheduler_add_periodic(task_stats_historic, STATS_UPDATE_HISTORIC_MS) != 0) {
+    printf("Unable to initialise historic statistics timer\n");
     return -1;
   }
 
@@ -632,9 +385,58 @@ int alarms_initialise() {
   return 0;
 }
 
+// Quantities the refresh governor watches, as displayed
+static void read_refresh_inputs(const Snapshot_t* snapshot, RefreshInputs_t* inputs) {
+  inputs->bat_soc = battery_percentage(snapshot->lfp100s);
+  inputs->load_w = snapshot->rolling.load_w;
+  inputs->sol_w = snapshot->rvr40[RVR40_REG_SOLAR_W];
+  inputs->alt_w = snapshot->dcc50s[DCC50S_REG_ALT_W];
+  inputs->faults = ((uint64_t)snapshot->dcc50s[DCC50S_REG_ERR_1] << 48)
+    | ((uint64_t)snapshot->dcc50s[DCC50S_REG_ERR_2] << 32)
+    | ((uint64_t)snapshot->rvr40[RVR40_REG_ERR_1] << 16)
+    | snapshot->rvr40[RVR40_REG_ERR_2];
+  inputs->published = snapshot->published_at != 0;
+}
+
+// Act on everything posted since the last pass, presses made during a refresh arrive together
+static void handle_events() {
+  Event_t event;
+  uint8_t presses = 0;
+
+  while(events_pop(&event)) {
+    switch(event.type) {
+      case EventButton:
+        // measure from the earliest press not yet on the panel
+        if(presses++ == 0 && page_requested_at == 0)
+          page_requested_at = event.posted_at;
+        break;
+
+      case EventSample:
+        scheduler_post(task_stats_rolling);
+        break;
+
+      case EventData:
+        // re-render the cached pages in the background, the refresh governor
+        // is evaluated on every pass of the main loop
+#ifndef EPD_RENDER_BANDED
+        page_cache_invalidate();
+#endif
+        break;
+    }
+  }
+
+  if(presses > 0) {
+    current_page = (current_page + presses) % PageContentsCount;
+    refresh_governor_request();
+    printf("Changed current page to %d (%d presses)\n", current_page, presses);
+  }
+}
+
 int main() {
   int state;
-  uint64_t last_epd_update;
+  uint64_t next_render_eval_us;
+  RefreshInputs_t refresh_inputs;
+  RefreshDecision_t refresh_decision;
 
   stdio_init_all();
 
@@ -645,14 +447,21 @@ int main() {
   gpio_set_irq_enabled_with_callback(BTN_PIN, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true, &btn_handler);
 
   current_page = Overview;
+  events_init();
+#ifndef EPD_RENDER_BANDED
+  page_cache_init();
+#endif
+  stats_history_init(&stats_history);
+  stats_query_init(&stats_query, &stats_history);
+  refresh_governor_init(EPD_REFRESH_RATE_MS, EPD_REFRESH_MAX_MS, EPD_REFRESH_SPACING_MS);
   btn_last_pressed = time_us_64();
-  last_epd_update = time_us_64();
+  next_render_eval_us = time_us_64();
 
   state = devices_modbus_init();
   if(state != 0) {
     return state;
   }
-  state = alarms_initialise();
+  state = tasks_initialise();
   if(state != 0) {
     return state;
   }
@@ -668,28 +477,50 @@ int main() {
     return state;
   }
 
-  display_init();
-  display_state = true;
+  // Device I/O runs on core 1 from here on
+  acquisition_start(STATS_UPDATE_ROLLING_MS, on_acquisition_sample);
+
+  display_init(&EPD_PANEL);
+  display_set_standby_limit(EPD_STANDBY_MAX_MS);
   display_clear();
   busy_wait_ms(500);
   gpio_put(LED_PIN, 0);
 
   // Main update loop
-  //  This loop should be interrupted by the alarms to update rolling
-  //  and historic data from the modbus devices
+  //  Runs the tasks released by the timers to update rolling
+  //  and historic data from the modbus devices, sleeping in between.
+  //  Button presses and published data post events that wake the loop,
+  //  and the refresh governor is consulted on every pass, so page changes
+  //  and significant changes reach the display straight away
   while(1) {
+    handle_events();
     time_since_boot = time_us_64();
-    gpio_put(LED_PIN, 1);
 
-    // update the display if adequate time has passed
-    if(time_since_boot > last_epd_update ) {
-      update_page();
+    snapshot_read(&snapshot, &view);
+    read_refresh_inputs(&view, &refresh_inputs);
+    refresh_decision = refresh_governor_decide(&refresh_inputs, time_since_boot);
+
+    if(refresh_governor_should_render(refresh_decision)) {
+#ifdef _VERBOSE
+      printf("Rendering for %s\n", refresh_governor_decision_name(refresh_decision));
+#endif
+      gpio_put(LED_PIN, 1);
+      bool refreshed = update_page();
+      gpio_put(LED_PIN, 0);
 
-      last_epd_update = time_since_boot + (EPD_REFRESH_RATE_MS * 1000);
+      refresh_governor_rendered(&refresh_inputs, refresh_decision, refreshed, time_us_64());
     }
+    next_render_eval_us = refresh_governor_next();
 
-    gpio_put(LED_PIN, 0);
-    sleep_ms(STATS_UPDATE_ROLLING_MS);
+    // standby when the next refresh is close, deep sleep when it is not (or never came)
+    time_since_boot = time_us_64();
+    display_power_down(next_render_eval_us > time_since_boot ? (next_render_eval_us - time_since_boot) / 1000 : 0);
+    display_power_idle(time_since_boot);
+
+    if(!scheduler_run_next() && !events_pending()) {
+      const uint64_t standby_until = display_power_deadline();
+      scheduler_wait(standby_until < next_render_eval_us ? standby_until : next_render_eval_us);
+    }
   }
 }
 
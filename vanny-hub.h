@@ -5,39 +5,55 @@
 #include <hardware/irq.h>
 
 #include "display/display.h"
-
-#define _VERBOSE
+#include "stats-history.h"
+#include "stats-query.h"
+#include "chart.h"
+#include "format.h"
+#include "pages.h"
+#include "scheduler.h"
+#include "snapshot.h"
+#include "acquisition.h"
+#include "refresh-governor.h"
+#include "events.h"
 
 #define LED_PIN 25
 #define BTN_PIN 21
 
 //#define EPD_UPDATE_PARTIAL
+#define EPD_PANEL               panel_uc8151_bwr  // or panel_uc8151_bw, panel_host
+//#define EPD_RENDER_BANDED       // record pages and render them band by band, for large panels
 #define EPD_FULL_REFRESH_AFTER  3
-#define EPD_REFRESH_RATE_MS     60000
+#define EPD_REFRESH_RATE_MS     60000     // base interval, backed off when values are flat
+#define EPD_REFRESH_MAX_MS      1800000
+#define EPD_REFRESH_SPACING_MS  30000     // minimum between panel refreshes
+#define EPD_STANDBY_MAX_MS      300000    // shorter expected idle stays in standby, longer deep sleeps
 
 #define RS485_DCC50S_ADDRESS    0x01
 #define RS485_LFP100S_ADDRESS   0xf7
 #define RS232_RVR40_ADDRESS     0x01
 
-#define STATS_MAX_HISTORY        168
 #define STATS_UPDATE_ROLLING_MS  10000     // (secondly)
 #define STATS_UPDATE_HISTORIC_MS 3600000  // (hourly)
 
-typedef enum {
-  Overview,
-  Solar,
-  Alternator,
-  Statistics,
-  PageContentsCount,
-} PageContents_t;
+#define TASK_ROLLING_DEADLINE_MS  1000
+#define TASK_HISTORIC_DEADLINE_MS 1000
+#define TASK_PAGES_DEADLINE_MS    1000
+
+#if defined(EPD_RENDER_BANDED) && defined(EPD_UPDATE_PARTIAL)
+#error "EPD_RENDER_BANDED keeps no copy of the screen to diff for EPD_UPDATE_PARTIAL"
+#endif
 
+/* Planes of a page, rendered in the background whenever the published data changes
+ *  Each render starts from a copy of the page's static layer (labels, axes, menu),
+ *  which is drawn once on first use, and only the values are drawn on top.
+ */
 typedef struct {
-  uint16_t index;
-  float bat_soc;
-  float bat_v;
-  float load_w;
-  uint16_t sol_w;
-  uint16_t alt_w;
-  uint16_t charged_ah;
-  uint16_t discharged_ah;
-} Statshot_t;
+  uint8_t black[CANVAS_SIZE];
+  uint8_t red[CANVAS_SIZE];
+  uint8_t static_black[CANVAS_SIZE];
+  uint8_t static_red[CANVAS_SIZE];
+  bool static_ready;
+  Canvas_t canvas;
+  uint32_t fingerprint;           // of both planes, as rendered
+  bool stale;
+} PageCache_t;